@@ -0,0 +1,444 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of atomic operations for different value sizes, memory orders and numbers of threads.
+// The threads either operate on the same atomic object (shared contention mode) or on separate atomic objects located
+// in different cache lines (private contention mode). Compile the benchmark with BOOST_ATOMIC_FORCE_FALLBACK defined
+// to measure the lock-based implementation.
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <exception>
+#include <type_traits>
+#include <boost/config.hpp>
+
+#include "bench_helpers.hpp"
+
+//! Benchmark parameters
+struct bench_params
+{
+    std::vector< std::string > ops;
+    std::vector< std::string > types;
+    std::vector< std::string > orders;
+    std::vector< std::string > contention;
+    std::vector< unsigned int > thread_counts;
+    std::chrono::milliseconds duration;
+};
+
+//! Number of operations performed between checks for the end of the run
+constexpr unsigned int batch_size = 256u;
+
+enum class op_kind
+{
+    load,
+    store,
+    modify
+};
+
+//! Returns \c true if the memory order is allowed for the operation kind
+constexpr bool is_valid_order(op_kind kind, boost::memory_order order) noexcept
+{
+    return kind == op_kind::load ? (order != boost::memory_order_release && order != boost::memory_order_acq_rel) :
+        (kind == op_kind::store ? (order != boost::memory_order_acquire && order != boost::memory_order_acq_rel) : true);
+}
+
+template< boost::memory_order Order >
+struct order_name;
+
+template< >
+struct order_name< boost::memory_order_relaxed > { static const char* get() noexcept { return "relaxed"; } };
+template< >
+struct order_name< boost::memory_order_acquire > { static const char* get() noexcept { return "acquire"; } };
+template< >
+struct order_name< boost::memory_order_release > { static const char* get() noexcept { return "release"; } };
+template< >
+struct order_name< boost::memory_order_acq_rel > { static const char* get() noexcept { return "acq_rel"; } };
+template< >
+struct order_name< boost::memory_order_seq_cst > { static const char* get() noexcept { return "seq_cst"; } };
+
+template< typename T >
+struct type_name;
+
+template< >
+struct type_name< std::uint8_t > { static const char* get() noexcept { return "uint8"; } };
+template< >
+struct type_name< std::uint16_t > { static const char* get() noexcept { return "uint16"; } };
+template< >
+struct type_name< std::uint32_t > { static const char* get() noexcept { return "uint32"; } };
+template< >
+struct type_name< std::uint64_t > { static const char* get() noexcept { return "uint64"; } };
+#if defined(BOOST_HAS_INT128)
+template< >
+struct type_name< boost::uint128_type > { static const char* get() noexcept { return "uint128"; } };
+#endif
+
+/*
+ * Benchmarked operations. Each operation is called with the sequence number of the call in the thread,
+ * which is used to produce the operation argument.
+ */
+
+struct op_load
+{
+    static constexpr op_kind kind = op_kind::load;
+    static const char* name() noexcept { return "load"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        consume(a.load(Order));
+    }
+};
+
+struct op_store
+{
+    static constexpr op_kind kind = op_kind::store;
+    static const char* name() noexcept { return "store"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept
+    {
+        a.store(static_cast< T >(n), Order);
+    }
+};
+
+struct op_exchange
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "exchange"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept
+    {
+        consume(a.exchange(static_cast< T >(n), Order));
+    }
+};
+
+//! Increments the value with a CAS, using the value from the previous call as the expected value
+struct op_compare_exchange_weak
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "compare_exchange_weak"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        static thread_local T expected = 0u;
+        T old_val = expected;
+        if (a.compare_exchange_weak(old_val, static_cast< T >(old_val + 1u), Order))
+            ++old_val;
+        expected = old_val;
+    }
+};
+
+//! Increments the value with a CAS, using the value from the previous call as the expected value
+struct op_compare_exchange_strong
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "compare_exchange_strong"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        static thread_local T expected = 0u;
+        T old_val = expected;
+        if (a.compare_exchange_strong(old_val, static_cast< T >(old_val + 1u), Order))
+            ++old_val;
+        expected = old_val;
+    }
+};
+
+#define BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(op_name)\
+    struct op_ ## op_name\
+    {\
+        static constexpr op_kind kind = op_kind::modify;\
+        static const char* name() noexcept { return #op_name; }\
+\
+        template< boost::memory_order Order, typename T >\
+        static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept\
+        {\
+            consume(a.op_name(static_cast< T >(n), Order));\
+        }\
+    };
+
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_add)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_sub)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_and)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_or)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_xor)
+// In the steady state, fetch_max and fetch_min mostly don't modify the value, which is typical for their uses
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_max)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(fetch_min)
+BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP(add_and_test)
+
+#undef BOOST_ATOMIC_BENCH_DEFINE_FETCH_OP
+
+struct op_opaque_add
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "opaque_add"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept
+    {
+        a.opaque_add(static_cast< T >(n), Order);
+    }
+};
+
+struct op_fetch_negate
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "fetch_negate"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        consume(a.fetch_negate(Order));
+    }
+};
+
+struct op_fetch_complement
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "fetch_complement"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        consume(a.fetch_complement(Order));
+    }
+};
+
+struct op_bit_test_and_complement
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "bit_test_and_complement"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept
+    {
+        consume(a.bit_test_and_complement(static_cast< unsigned int >(n % (sizeof(T) * 8u)), Order));
+    }
+};
+
+//! Alternates between saturating addition and subtraction, so that the value does not saturate in the steady state
+struct op_fetch_add_sat
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "fetch_add_sat"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t n) noexcept
+    {
+        if ((n & 1u) == 0u)
+            consume(a.fetch_add_sat(static_cast< T >(1u), Order));
+        else
+            consume(a.fetch_sub_sat(static_cast< T >(1u), Order));
+    }
+};
+
+struct op_fetch_update
+{
+    static constexpr op_kind kind = op_kind::modify;
+    static const char* name() noexcept { return "fetch_update"; }
+
+    template< boost::memory_order Order, typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a, std::uint64_t) noexcept
+    {
+        consume(a.fetch_update([](T const& val) noexcept { return static_cast< T >(val * 3u + 1u); }, Order));
+    }
+};
+
+template< typename Op, typename T, boost::memory_order Order >
+void run_benchmark(bench_params const& params, result_writer& writer, std::true_type)
+{
+    for (std::string const& contention : params.contention)
+    {
+        const bool shared = contention == "shared";
+        for (unsigned int thread_count : params.thread_counts)
+        {
+            // Start from the middle of the value range, so that saturating operations don't saturate
+            cache_aligned_array< boost::atomic< T > > atomics(shared ? 1u : thread_count, 0u, static_cast< T >(static_cast< T >(~static_cast< T >(0u)) / 2u));
+            cache_aligned_array< thread_result > results(thread_count, 0u);
+            run_control control;
+
+            std::vector< std::thread > threads;
+            threads.reserve(thread_count);
+            for (unsigned int i = 0u; i < thread_count; ++i)
+            {
+                threads.emplace_back([&atomics, &results, &control, shared, i]()
+                {
+                    boost::atomic< T >& a = atomics[shared ? 0u : i];
+                    std::uint64_t n = 0u;
+                    control.wait_for_start();
+                    do
+                    {
+                        for (unsigned int j = 0u; j < batch_size; ++j, ++n)
+                            Op::template run< Order >(a, n);
+                    }
+                    while (!control.is_stopped());
+
+                    results[i].end_time = bench_clock::now();
+                    results[i].op_count = n;
+                });
+            }
+
+            const bench_clock::time_point start_time = control.run(thread_count, params.duration);
+
+            for (std::thread& thread : threads)
+                thread.join();
+
+            std::uint64_t op_count = 0u;
+            bench_clock::time_point end_time = start_time;
+            for (unsigned int i = 0u; i < thread_count; ++i)
+            {
+                op_count += results[i].op_count;
+                if (results[i].end_time > end_time)
+                    end_time = results[i].end_time;
+            }
+
+            const double seconds = std::chrono::duration< double >(end_time - start_time).count();
+
+            writer.write(std::vector< result_field >{
+                result_field("backend", get_backend_name()),
+                result_field("operation", Op::name()),
+                result_field("type", type_name< T >::get()),
+                result_field("size", static_cast< unsigned int >(sizeof(T))),
+                result_field("lock_free", static_cast< unsigned int >(atomics[0].is_lock_free())),
+                result_field("order", order_name< Order >::get()),
+                result_field("contention", contention),
+                result_field("threads", thread_count),
+                result_field("operations", op_count),
+                result_field("seconds", seconds),
+                // Average duration of an operation, as observed by a thread
+                result_field("ns_per_op", seconds * 1e9 * thread_count / static_cast< double >(op_count)),
+                // Total throughput of all threads
+                result_field("ops_per_sec", static_cast< double >(op_count) / seconds)
+            });
+        }
+    }
+}
+
+template< typename Op, typename T, boost::memory_order Order >
+inline void run_benchmark(bench_params const&, result_writer&, std::false_type)
+{
+}
+
+template< typename Op, typename T, boost::memory_order Order >
+inline void run_order(bench_params const& params, result_writer& writer)
+{
+    if (is_selected(params.orders, order_name< Order >::get()))
+        run_benchmark< Op, T, Order >(params, writer, std::integral_constant< bool, is_valid_order(Op::kind, Order) >());
+}
+
+template< typename Op, typename T >
+void run_op(bench_params const& params, result_writer& writer)
+{
+    if (!is_selected(params.ops, Op::name()))
+        return;
+
+    run_order< Op, T, boost::memory_order_relaxed >(params, writer);
+    run_order< Op, T, boost::memory_order_acquire >(params, writer);
+    run_order< Op, T, boost::memory_order_release >(params, writer);
+    run_order< Op, T, boost::memory_order_acq_rel >(params, writer);
+    run_order< Op, T, boost::memory_order_seq_cst >(params, writer);
+}
+
+template< typename T >
+void run_type(bench_params const& params, result_writer& writer)
+{
+    if (!is_selected(params.types, type_name< T >::get()))
+        return;
+
+    run_op< op_load, T >(params, writer);
+    run_op< op_store, T >(params, writer);
+    run_op< op_exchange, T >(params, writer);
+    run_op< op_compare_exchange_weak, T >(params, writer);
+    run_op< op_compare_exchange_strong, T >(params, writer);
+    run_op< op_fetch_add, T >(params, writer);
+    run_op< op_fetch_sub, T >(params, writer);
+    run_op< op_fetch_and, T >(params, writer);
+    run_op< op_fetch_or, T >(params, writer);
+    run_op< op_fetch_xor, T >(params, writer);
+    run_op< op_fetch_negate, T >(params, writer);
+    run_op< op_fetch_complement, T >(params, writer);
+    run_op< op_opaque_add, T >(params, writer);
+    run_op< op_add_and_test, T >(params, writer);
+    run_op< op_bit_test_and_complement, T >(params, writer);
+    run_op< op_fetch_max, T >(params, writer);
+    run_op< op_fetch_min, T >(params, writer);
+    run_op< op_fetch_add_sat, T >(params, writer);
+    run_op< op_fetch_update, T >(params, writer);
+}
+
+static void print_usage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+        "Options:\n"
+        "  --threads=N            Maximum number of threads, the default is the number of hardware threads\n"
+        "  --duration=MS          Duration of each run, in milliseconds, the default is 20\n"
+        "  --ops=LIST             Comma-separated list of operations to run, the default is all operations\n"
+        "  --types=LIST           Comma-separated list of value types (uint8, uint16, uint32, uint64, uint128), the default is all types\n"
+        "  --orders=LIST          Comma-separated list of memory orders (relaxed, acquire, release, acq_rel, seq_cst), the default is all orders\n"
+        "  --contention=LIST      Comma-separated list of contention modes (shared, private), the default is both modes\n"
+        "  --format=csv|json      Output format, the default is csv\n";
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        command_line args(argc, argv);
+        if (args.has("help"))
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+
+        args.check_known({ "help", "threads", "duration", "ops", "types", "orders", "contention", "format" });
+
+        bench_params params;
+        params.ops = args.get_list("ops");
+        params.types = args.get_list("types");
+        params.orders = args.get_list("orders");
+        params.contention = args.get_list("contention");
+        if (params.contention.empty())
+            params.contention = { "shared", "private" };
+        for (std::string const& contention : params.contention)
+        {
+            if (contention != "shared" && contention != "private")
+                throw std::invalid_argument("Invalid contention mode: " + contention);
+        }
+        params.thread_counts = get_thread_counts(args.get_unsigned("threads", get_default_max_threads()));
+        params.duration = std::chrono::milliseconds(args.get_unsigned("duration", 20u));
+
+        result_writer writer(std::cout, args.get_string("format", "csv"));
+
+        run_type< std::uint8_t >(params, writer);
+        run_type< std::uint16_t >(params, writer);
+        run_type< std::uint32_t >(params, writer);
+        run_type< std::uint64_t >(params, writer);
+#if defined(BOOST_HAS_INT128)
+        run_type< boost::uint128_type >(params, writer);
+#endif
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,504 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_ATOMIC_BENCH_BENCH_HELPERS_HPP_INCLUDED_
+#define BOOST_ATOMIC_BENCH_BENCH_HELPERS_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <new>
+#include <boost/config.hpp>
+#include <boost/atomic/thread_pause.hpp>
+
+// Note: The benchmark harness uses std::atomic for thread coordination, so that the coordination does not depend on
+// the Boost.Atomic implementation being measured (e.g. it does not use the lock pool when BOOST_ATOMIC_FORCE_FALLBACK is defined).
+
+//! Cache line size assumed by the benchmarks to separate data accessed by different threads
+constexpr std::size_t bench_cache_line_size = 64u;
+
+using bench_clock = std::chrono::steady_clock;
+
+//! Returns the name of the Boost.Atomic backend the benchmark is compiled for
+inline const char* get_backend_name()
+{
+#if defined(BOOST_ATOMIC_FORCE_FALLBACK)
+    return "fallback";
+#else
+    return "native";
+#endif
+}
+
+//! Returns the default maximum number of threads used by the benchmarks
+inline unsigned int get_default_max_threads()
+{
+    const unsigned int n = std::thread::hardware_concurrency();
+    return n > 0u ? n : 1u;
+}
+
+//! Returns the thread counts to run a benchmark with: powers of two up to \a max_threads, and \a max_threads itself
+inline std::vector< unsigned int > get_thread_counts(unsigned int max_threads)
+{
+    std::vector< unsigned int > counts;
+    for (unsigned int n = 1u; n < max_threads; n *= 2u)
+        counts.push_back(n);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+//! Command line options in the form of <tt>--name=value</tt>
+class command_line
+{
+private:
+    std::vector< std::pair< std::string, std::string > > m_options;
+
+public:
+    command_line(int argc, char* argv[])
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg = argv[i];
+            if (std::strncmp(arg, "--", 2u) != 0)
+                throw std::invalid_argument(std::string("Invalid command line argument: ") + arg);
+
+            arg += 2u;
+            const char* eq = std::strchr(arg, '=');
+            if (eq)
+                m_options.emplace_back(std::string(arg, eq), std::string(eq + 1));
+            else
+                m_options.emplace_back(std::string(arg), std::string());
+        }
+    }
+
+    //! Throws if any of the specified options is not in the list of \a known options
+    void check_known(std::vector< const char* > const& known) const
+    {
+        for (auto const& option : m_options)
+        {
+            bool found = false;
+            for (const char* name : known)
+                found |= option.first == name;
+            if (!found)
+                throw std::invalid_argument("Unknown command line option: --" + option.first);
+        }
+    }
+
+    //! Returns \c true if the option is specified
+    bool has(const char* name) const
+    {
+        return find(name) != nullptr;
+    }
+
+    //! Returns the option value or \a def if the option is not specified
+    std::string get_string(const char* name, const char* def) const
+    {
+        const std::string* value = find(name);
+        return value ? *value : std::string(def);
+    }
+
+    //! Returns the option value as an unsigned integer, not less than \a min_value, or \a def if the option is not specified
+    unsigned int get_unsigned(const char* name, unsigned int def, unsigned int min_value = 1u) const
+    {
+        const std::string* value = find(name);
+        if (!value)
+            return def;
+
+        char* end = nullptr;
+        const unsigned long n = std::strtoul(value->c_str(), &end, 10);
+        if (value->empty() || *end != '\0' || n < min_value || n > 0xFFFFFFFFul)
+            throw std::invalid_argument("Invalid value of --" + std::string(name) + ": " + *value);
+
+        return static_cast< unsigned int >(n);
+    }
+
+    //! Returns the comma-separated list of option values, or an empty list if the option is not specified
+    std::vector< std::string > get_list(const char* name) const
+    {
+        std::vector< std::string > list;
+        const std::string* value = find(name);
+        if (value)
+        {
+            std::string::size_type pos = 0u;
+            while (pos <= value->size())
+            {
+                std::string::size_type comma = value->find(',', pos);
+                if (comma == std::string::npos)
+                    comma = value->size();
+                if (comma > pos)
+                    list.push_back(value->substr(pos, comma - pos));
+                pos = comma + 1u;
+            }
+        }
+
+        return list;
+    }
+
+private:
+    const std::string* find(const char* name) const
+    {
+        for (auto const& option : m_options)
+        {
+            if (option.first == name)
+                return &option.second;
+        }
+
+        return nullptr;
+    }
+};
+
+//! Returns \c true if \a filter is empty or contains \a name
+inline bool is_selected(std::vector< std::string > const& filter, const char* name)
+{
+    return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+}
+
+//! Benchmark result field
+struct result_field
+{
+    const char* name;
+    std::string value;
+    bool is_number;
+
+    result_field(const char* n, std::string const& v) : name(n), value(v), is_number(false) {}
+    result_field(const char* n, const char* v) : name(n), value(v), is_number(false) {}
+    result_field(const char* n, std::uint64_t v) : name(n), value(std::to_string(v)), is_number(true) {}
+    result_field(const char* n, unsigned int v) : name(n), value(std::to_string(v)), is_number(true) {}
+    result_field(const char* n, double v) : name(n), is_number(true)
+    {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%.6g", v);
+        value = buf;
+    }
+};
+
+//! Writes benchmark results in CSV or JSON format
+class result_writer
+{
+private:
+    std::ostream& m_strm;
+    bool m_json;
+    std::size_t m_row_count;
+
+public:
+    explicit result_writer(std::ostream& strm, std::string const& format) :
+        m_strm(strm),
+        m_json(false),
+        m_row_count(0u)
+    {
+        if (format == "json")
+            m_json = true;
+        else if (format != "csv")
+            throw std::invalid_argument("Invalid output format: " + format);
+
+        if (m_json)
+            m_strm << "[";
+    }
+
+    result_writer(result_writer const&) = delete;
+    result_writer& operator= (result_writer const&) = delete;
+
+    ~result_writer()
+    {
+        if (m_json)
+            m_strm << (m_row_count > 0u ? "\n]\n" : "]\n");
+        m_strm.flush();
+    }
+
+    //! Writes a row of results. All rows must have the same fields.
+    void write(std::vector< result_field > const& row)
+    {
+        if (m_json)
+        {
+            m_strm << (m_row_count > 0u ? ",\n  {" : "\n  {");
+            for (std::size_t i = 0u, n = row.size(); i < n; ++i)
+            {
+                if (i > 0u)
+                    m_strm << ", ";
+                m_strm << '"' << row[i].name << "\": ";
+                if (row[i].is_number)
+                    m_strm << row[i].value;
+                else
+                    m_strm << '"' << row[i].value << '"';
+            }
+            m_strm << "}";
+        }
+        else
+        {
+            if (m_row_count == 0u)
+                write_csv_row(row, true);
+            write_csv_row(row, false);
+        }
+
+        ++m_row_count;
+        m_strm.flush();
+    }
+
+private:
+    void write_csv_row(std::vector< result_field > const& row, bool header)
+    {
+        for (std::size_t i = 0u, n = row.size(); i < n; ++i)
+        {
+            if (i > 0u)
+                m_strm << ',';
+            m_strm << (header ? std::string(row[i].name) : row[i].value);
+        }
+        m_strm << '\n';
+    }
+};
+
+//! Starts a number of threads simultaneously and stops them after a given duration
+class run_control
+{
+private:
+    std::atomic< unsigned int > m_ready_count;
+    std::atomic< bool > m_started;
+    std::atomic< bool > m_stopped;
+
+public:
+    run_control() : m_ready_count(0u), m_started(false), m_stopped(false)
+    {
+    }
+
+    run_control(run_control const&) = delete;
+    run_control& operator= (run_control const&) = delete;
+
+    //! Called by the benchmark threads to wait for the start of the run
+    void wait_for_start()
+    {
+        m_ready_count.fetch_add(1u, std::memory_order_relaxed);
+        while (!m_started.load(std::memory_order_acquire))
+            boost::atomics::thread_pause();
+    }
+
+    //! Returns \c true if the benchmark threads should stop
+    bool is_stopped() const
+    {
+        return m_stopped.load(std::memory_order_relaxed);
+    }
+
+    //! Waits for \a thread_count threads to become ready, starts them, then sleeps for \a duration and stops the threads. Returns the start time.
+    bench_clock::time_point run(unsigned int thread_count, std::chrono::milliseconds duration)
+    {
+        while (m_ready_count.load(std::memory_order_relaxed) < thread_count)
+            std::this_thread::yield();
+
+        const bench_clock::time_point start = bench_clock::now();
+        m_started.store(true, std::memory_order_release);
+        std::this_thread::sleep_for(duration);
+        m_stopped.store(true, std::memory_order_relaxed);
+
+        return start;
+    }
+};
+
+/*!
+ * \brief Array of objects placed at the given stride, starting at a cache line boundary
+ *
+ * By default, each object is placed in its own cache line(s), which avoids false sharing between objects.
+ * Unlike containers with the default allocator, the array also works for non-copyable and non-movable types.
+ */
+template< typename T >
+class cache_aligned_array
+{
+private:
+    std::vector< unsigned char > m_buffer;
+    unsigned char* m_base;
+    std::size_t m_size;
+    std::size_t m_stride;
+
+public:
+    //! Constructs \a size objects from \a args. If \a stride is zero, each object is placed in separate cache lines.
+    template< typename... Args >
+    explicit cache_aligned_array(std::size_t size, std::size_t stride, Args const&... args) :
+        m_base(nullptr),
+        m_size(0u),
+        m_stride(stride > 0u ? stride : (sizeof(T) + bench_cache_line_size - 1u) / bench_cache_line_size * bench_cache_line_size)
+    {
+        if (m_stride < sizeof(T) || m_stride % alignof(T) != 0u)
+            throw std::invalid_argument("Invalid array element stride");
+
+        m_buffer.resize(m_stride * size + bench_cache_line_size);
+        const std::uintptr_t addr = reinterpret_cast< std::uintptr_t >(m_buffer.data());
+        m_base = m_buffer.data() + ((bench_cache_line_size - addr % bench_cache_line_size) % bench_cache_line_size);
+
+        for (; m_size < size; ++m_size)
+            new (m_base + m_size * m_stride) T(args...);
+    }
+
+    //! Constructs \a size objects from \a args in the external \a memory of \a memory_size bytes
+    template< typename... Args >
+    cache_aligned_array(void* memory, std::size_t memory_size, std::size_t size, std::size_t stride, Args const&... args) :
+        m_base(nullptr),
+        m_size(0u),
+        m_stride(stride > 0u ? stride : (sizeof(T) + bench_cache_line_size - 1u) / bench_cache_line_size * bench_cache_line_size)
+    {
+        if (m_stride < sizeof(T) || m_stride % alignof(T) != 0u)
+            throw std::invalid_argument("Invalid array element stride");
+
+        const std::uintptr_t addr = reinterpret_cast< std::uintptr_t >(memory);
+        const std::size_t padding = (bench_cache_line_size - addr % bench_cache_line_size) % bench_cache_line_size;
+        if (memory_size < padding || (memory_size - padding) / m_stride < size)
+            throw std::invalid_argument("Insufficient memory for the array");
+
+        m_base = static_cast< unsigned char* >(memory) + padding;
+
+        for (; m_size < size; ++m_size)
+            new (m_base + m_size * m_stride) T(args...);
+    }
+
+    cache_aligned_array(cache_aligned_array const&) = delete;
+    cache_aligned_array& operator= (cache_aligned_array const&) = delete;
+
+    ~cache_aligned_array()
+    {
+        while (m_size > 0u)
+            (*this)[--m_size].~T();
+    }
+
+    std::size_t size() const noexcept { return m_size; }
+
+    T& operator[] (std::size_t i) noexcept
+    {
+        return *reinterpret_cast< T* >(m_base + i * m_stride);
+    }
+};
+
+//! Per-thread benchmark results
+struct thread_result
+{
+    //! Number of performed operations
+    std::uint64_t op_count = 0u;
+    //! Time when the thread completed its last operation
+    bench_clock::time_point end_time;
+};
+
+//! Returns the current time in nanoseconds, relative to an unspecified epoch
+inline std::uint64_t get_time_ns() noexcept
+{
+    return static_cast< std::uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(bench_clock::now().time_since_epoch()).count());
+}
+
+/*!
+ * \brief Histogram of latencies in nanoseconds
+ *
+ * Latencies below 16 ns are counted exactly. Larger latencies are counted in 16 linear buckets per power of two,
+ * which limits the relative error of the reported percentiles to 1/16.
+ */
+class latency_histogram
+{
+private:
+    static constexpr unsigned int sub_bucket_bits = 4u;
+    static constexpr unsigned int sub_bucket_count = 1u << sub_bucket_bits;
+    static constexpr unsigned int bucket_count = (64u - sub_bucket_bits + 1u) * sub_bucket_count;
+
+    std::uint64_t m_counts[bucket_count];
+    std::uint64_t m_sample_count;
+    std::uint64_t m_sum;
+    std::uint64_t m_max;
+
+public:
+    latency_histogram() noexcept : m_counts(), m_sample_count(0u), m_sum(0u), m_max(0u)
+    {
+    }
+
+    //! Adds a latency sample
+    void add(std::uint64_t ns) noexcept
+    {
+        ++m_counts[get_bucket_index(ns)];
+        ++m_sample_count;
+        m_sum += ns;
+        if (ns > m_max)
+            m_max = ns;
+    }
+
+    //! Adds samples from another histogram
+    void merge(latency_histogram const& that) noexcept
+    {
+        for (unsigned int i = 0u; i < bucket_count; ++i)
+            m_counts[i] += that.m_counts[i];
+        m_sample_count += that.m_sample_count;
+        m_sum += that.m_sum;
+        if (that.m_max > m_max)
+            m_max = that.m_max;
+    }
+
+    std::uint64_t sample_count() const noexcept { return m_sample_count; }
+    std::uint64_t max() const noexcept { return m_max; }
+    double mean() const noexcept { return m_sample_count > 0u ? static_cast< double >(m_sum) / static_cast< double >(m_sample_count) : 0.0; }
+
+    //! Returns the latency that is not exceeded by the given fraction of samples (e.g. 0.99 for 99th percentile)
+    std::uint64_t percentile(double fraction) const noexcept
+    {
+        if (m_sample_count == 0u)
+            return 0u;
+
+        std::uint64_t threshold = static_cast< std::uint64_t >(fraction * static_cast< double >(m_sample_count));
+        if (threshold == 0u)
+            threshold = 1u;
+
+        std::uint64_t count = 0u;
+        for (unsigned int i = 0u; i < bucket_count; ++i)
+        {
+            count += m_counts[i];
+            if (count >= threshold)
+            {
+                // Report the upper bound of the bucket, but not more than the maximum observed latency
+                const std::uint64_t upper_bound = get_bucket_upper_bound(i);
+                return upper_bound < m_max ? upper_bound : m_max;
+            }
+        }
+
+        return m_max;
+    }
+
+private:
+    static unsigned int get_bucket_index(std::uint64_t ns) noexcept
+    {
+        if (ns < sub_bucket_count)
+            return static_cast< unsigned int >(ns);
+
+        unsigned int log2 = 0u;
+        for (std::uint64_t x = ns; x > 1u; x >>= 1u)
+            ++log2;
+
+        const unsigned int shift = log2 - sub_bucket_bits;
+        return (shift + 1u) * sub_bucket_count + static_cast< unsigned int >((ns >> shift) & (sub_bucket_count - 1u));
+    }
+
+    static std::uint64_t get_bucket_upper_bound(unsigned int index) noexcept
+    {
+        if (index < sub_bucket_count)
+            return index;
+
+        const unsigned int shift = index / sub_bucket_count - 1u;
+        const std::uint64_t lower_bound = static_cast< std::uint64_t >(sub_bucket_count + index % sub_bucket_count) << shift;
+        return lower_bound + ((static_cast< std::uint64_t >(1u) << shift) - 1u);
+    }
+};
+
+//! Consumes a value, so that the compiler does not optimize away the computation of the value
+template< typename T >
+BOOST_FORCEINLINE void consume(T const& value)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__ ("" : : "r" (&value) : "memory");
+#else
+    static volatile unsigned char sink;
+    sink = *reinterpret_cast< const volatile unsigned char* >(&value);
+#endif
+}
+
+#endif // BOOST_ATOMIC_BENCH_BENCH_HELPERS_HPP_INCLUDED_
@@ -0,0 +1,393 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures throughput of lock-based atomic operations on many distinct atomic objects and reports
+// how the objects are distributed between the locks of the lock pool. Collisions of unrelated atomic objects
+// on the same lock serialize operations on these objects. The objects are placed in arrays, either densely
+// or with each object in its own cache line, and the threads operate on randomly selected objects.
+//
+// The lock pool size can be selected with --pool-size option or BOOST_ATOMIC_LOCK_POOL_SIZE environment variable.
+// Since the size cannot be changed after the lock pool is initialized, run the benchmark multiple times to compare
+// different lock pool sizes.
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/lock_pool.hpp>
+// Used to compute the lock pool indices of the atomic objects
+#include <boost/atomic/detail/lock_pool.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <boost/config.hpp>
+
+#include "bench_helpers.hpp"
+
+//! Benchmark parameters
+struct bench_params
+{
+    std::vector< std::string > ops;
+    std::vector< std::string > types;
+    std::vector< std::string > layouts;
+    std::vector< unsigned int > thread_counts;
+    std::size_t object_count;
+    std::chrono::milliseconds duration;
+    bool report_buckets;
+};
+
+//! Number of operations performed between checks for the end of the run
+constexpr unsigned int batch_size = 64u;
+
+//! Value of the given size, in bytes
+template< std::size_t Size >
+struct value
+{
+    std::uint64_t data[Size / sizeof(std::uint64_t)];
+};
+
+template< typename T >
+struct type_name;
+
+template< >
+struct type_name< value< 8u > > { static const char* get() noexcept { return "bytes8"; } };
+template< >
+struct type_name< value< 16u > > { static const char* get() noexcept { return "bytes16"; } };
+template< >
+struct type_name< value< 32u > > { static const char* get() noexcept { return "bytes32"; } };
+template< >
+struct type_name< value< 64u > > { static const char* get() noexcept { return "bytes64"; } };
+
+/*
+ * Benchmarked operations
+ */
+
+struct op_load
+{
+    static const char* name() noexcept { return "load"; }
+
+    template< typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a) noexcept
+    {
+        consume(a.load());
+    }
+};
+
+struct op_store
+{
+    static const char* name() noexcept { return "store"; }
+
+    template< typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a) noexcept
+    {
+        a.store(T());
+    }
+};
+
+struct op_exchange
+{
+    static const char* name() noexcept { return "exchange"; }
+
+    template< typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a) noexcept
+    {
+        consume(a.exchange(T()));
+    }
+};
+
+//! Increments a member of the value in a loop of load and compare_exchange_weak
+struct op_cas_increment
+{
+    static const char* name() noexcept { return "cas_increment"; }
+
+    template< typename T >
+    static BOOST_FORCEINLINE void run(boost::atomic< T >& a) noexcept
+    {
+        T expected = a.load(boost::memory_order_relaxed);
+        T desired;
+        do
+        {
+            desired = expected;
+            ++desired.data[0];
+        }
+        while (!a.compare_exchange_weak(expected, desired));
+    }
+};
+
+//! Static distribution of the atomic objects between the locks of the lock pool
+struct bucket_distribution
+{
+    //! Lock pool index of every atomic object
+    std::vector< std::size_t > object_buckets;
+    //! Number of atomic objects per lock pool entry
+    std::vector< std::size_t > bucket_objects;
+    std::size_t used_buckets;
+    std::size_t max_bucket_objects;
+    //! Fraction of the atomic objects that share their lock pool entry with other objects
+    double collision_rate;
+    //! The collision rate if the objects were distributed uniformly at random
+    double expected_collision_rate;
+
+    template< typename T >
+    bucket_distribution(cache_aligned_array< boost::atomic< T > >& atomics, std::size_t pool_size) :
+        object_buckets(atomics.size()),
+        bucket_objects(pool_size),
+        used_buckets(0u),
+        max_bucket_objects(0u),
+        collision_rate(0.0),
+        expected_collision_rate(0.0)
+    {
+        // The lock-based operations use the storage alignment of the atomic object for hashing, which matches the alignment of the atomic object
+        const std::size_t object_count = atomics.size();
+        for (std::size_t i = 0u; i < object_count; ++i)
+        {
+            const std::size_t bucket = static_cast< std::size_t >(boost::atomics::detail::lock_pool::hash_ptr< alignof(boost::atomic< T >) >(&atomics[i]) & (pool_size - 1u));
+            object_buckets[i] = bucket;
+            ++bucket_objects[bucket];
+        }
+
+        std::size_t colliding_objects = 0u;
+        for (std::size_t n : bucket_objects)
+        {
+            if (n > 0u)
+                ++used_buckets;
+            if (n > 1u)
+                colliding_objects += n;
+            if (n > max_bucket_objects)
+                max_bucket_objects = n;
+        }
+
+        collision_rate = static_cast< double >(colliding_objects) / static_cast< double >(object_count);
+        expected_collision_rate = 1.0 - std::pow(1.0 - 1.0 / static_cast< double >(pool_size), static_cast< double >(object_count - 1u));
+    }
+};
+
+//! Generates pseudorandom numbers
+class xorshift32
+{
+private:
+    std::uint32_t m_state;
+
+public:
+    explicit xorshift32(std::uint32_t seed) noexcept : m_state(seed != 0u ? seed : 1u) {}
+
+    std::uint32_t operator() () noexcept
+    {
+        std::uint32_t x = m_state;
+        x ^= x << 13u;
+        x ^= x >> 17u;
+        x ^= x << 5u;
+        m_state = x;
+        return x;
+    }
+};
+
+template< typename Op, typename T >
+void run_benchmark(bench_params const& params, result_writer& writer, const char* layout, cache_aligned_array< boost::atomic< T > >& atomics, bucket_distribution const& distribution)
+{
+    const std::size_t object_count = atomics.size();
+    const std::size_t pool_size = distribution.bucket_objects.size();
+
+    for (unsigned int thread_count : params.thread_counts)
+    {
+        cache_aligned_array< thread_result > results(thread_count, 0u);
+        std::vector< std::vector< std::uint64_t > > object_hits(thread_count);
+        run_control control;
+
+        std::vector< std::thread > threads;
+        threads.reserve(thread_count);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+        {
+            threads.emplace_back([&atomics, &results, &object_hits, &control, object_count, i]()
+            {
+                xorshift32 rng(0x9E3779B9u * (i + 1u));
+                std::vector< std::uint64_t > hits(object_count);
+                std::uint64_t n = 0u;
+                control.wait_for_start();
+                do
+                {
+                    for (unsigned int j = 0u; j < batch_size; ++j)
+                    {
+                        // Map the random number onto [0, object_count) without a division
+                        const std::size_t index = static_cast< std::size_t >((static_cast< std::uint64_t >(rng()) * object_count) >> 32u);
+                        Op::run(atomics[index]);
+                        ++hits[index];
+                    }
+                    n += batch_size;
+                }
+                while (!control.is_stopped());
+
+                results[i].end_time = bench_clock::now();
+                results[i].op_count = n;
+                object_hits[i].swap(hits);
+            });
+        }
+
+        const bench_clock::time_point start_time = control.run(thread_count, params.duration);
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        std::uint64_t op_count = 0u;
+        bench_clock::time_point end_time = start_time;
+        std::vector< std::uint64_t > bucket_hits(pool_size);
+        for (unsigned int i = 0u; i < thread_count; ++i)
+        {
+            op_count += results[i].op_count;
+            if (results[i].end_time > end_time)
+                end_time = results[i].end_time;
+
+            for (std::size_t j = 0u; j < object_count; ++j)
+                bucket_hits[distribution.object_buckets[j]] += object_hits[i][j];
+        }
+
+        const double seconds = std::chrono::duration< double >(end_time - start_time).count();
+
+        if (params.report_buckets)
+        {
+            for (std::size_t j = 0u; j < pool_size; ++j)
+            {
+                writer.write(std::vector< result_field >{
+                    result_field("backend", get_backend_name()),
+                    result_field("operation", Op::name()),
+                    result_field("type", type_name< T >::get()),
+                    result_field("layout", layout),
+                    result_field("threads", thread_count),
+                    result_field("pool_size", static_cast< std::uint64_t >(pool_size)),
+                    result_field("bucket", static_cast< std::uint64_t >(j)),
+                    result_field("objects", static_cast< std::uint64_t >(distribution.bucket_objects[j])),
+                    result_field("hits", bucket_hits[j])
+                });
+            }
+        }
+        else
+        {
+            std::uint64_t max_bucket_hits = 0u;
+            for (std::uint64_t hits : bucket_hits)
+            {
+                if (hits > max_bucket_hits)
+                    max_bucket_hits = hits;
+            }
+
+            const double mean_bucket_hits = static_cast< double >(op_count) / static_cast< double >(distribution.used_buckets);
+
+            writer.write(std::vector< result_field >{
+                result_field("backend", get_backend_name()),
+                result_field("operation", Op::name()),
+                result_field("type", type_name< T >::get()),
+                result_field("size", static_cast< unsigned int >(sizeof(T))),
+                result_field("lock_free", static_cast< unsigned int >(atomics[0].is_lock_free())),
+                result_field("layout", layout),
+                result_field("objects", static_cast< std::uint64_t >(object_count)),
+                result_field("threads", thread_count),
+                result_field("pool_size", static_cast< std::uint64_t >(pool_size)),
+                result_field("used_buckets", static_cast< std::uint64_t >(distribution.used_buckets)),
+                result_field("max_bucket_objects", static_cast< std::uint64_t >(distribution.max_bucket_objects)),
+                result_field("collision_rate", distribution.collision_rate),
+                result_field("expected_collision_rate", distribution.expected_collision_rate),
+                // Ratio of the max number of operations on a lock pool entry to the average across the used entries
+                result_field("hit_imbalance", static_cast< double >(max_bucket_hits) / mean_bucket_hits),
+                result_field("operations", op_count),
+                result_field("seconds", seconds),
+                result_field("ns_per_op", seconds * 1e9 * thread_count / static_cast< double >(op_count)),
+                result_field("ops_per_sec", static_cast< double >(op_count) / seconds)
+            });
+        }
+    }
+}
+
+template< typename T >
+void run_layout(bench_params const& params, result_writer& writer, const char* layout, std::size_t stride)
+{
+    if (!is_selected(params.layouts, layout))
+        return;
+
+    cache_aligned_array< boost::atomic< T > > atomics(params.object_count, stride, T());
+    const bucket_distribution distribution(atomics, boost::atomics::get_lock_pool_size());
+
+    if (is_selected(params.ops, op_load::name()))
+        run_benchmark< op_load >(params, writer, layout, atomics, distribution);
+    if (is_selected(params.ops, op_store::name()))
+        run_benchmark< op_store >(params, writer, layout, atomics, distribution);
+    if (is_selected(params.ops, op_exchange::name()))
+        run_benchmark< op_exchange >(params, writer, layout, atomics, distribution);
+    if (is_selected(params.ops, op_cas_increment::name()))
+        run_benchmark< op_cas_increment >(params, writer, layout, atomics, distribution);
+}
+
+template< typename T >
+void run_type(bench_params const& params, result_writer& writer)
+{
+    if (!is_selected(params.types, type_name< T >::get()))
+        return;
+
+    run_layout< T >(params, writer, "dense", sizeof(boost::atomic< T >));
+    run_layout< T >(params, writer, "padded", 0u);
+}
+
+static void print_usage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+        "Options:\n"
+        "  --threads=N            Maximum number of threads, the default is the number of hardware threads\n"
+        "  --duration=MS          Duration of each run, in milliseconds, the default is 100\n"
+        "  --objects=N            Number of atomic objects, the default is 4096\n"
+        "  --pool-size=N          Number of locks in the lock pool, the default is selected by Boost.Atomic\n"
+        "  --ops=LIST             Comma-separated list of operations (load, store, exchange, cas_increment), the default is all operations\n"
+        "  --types=LIST           Comma-separated list of value types (bytes8, bytes16, bytes32, bytes64), the default is all types\n"
+        "  --layouts=LIST         Comma-separated list of object layouts (dense, padded), the default is all layouts\n"
+        "  --buckets              Report the number of objects and operations per lock pool entry instead of the summary\n"
+        "  --format=csv|json      Output format, the default is csv\n";
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        command_line args(argc, argv);
+        if (args.has("help"))
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+
+        args.check_known({ "help", "threads", "duration", "objects", "pool-size", "ops", "types", "layouts", "buckets", "format" });
+
+        // The lock pool size must be set before the lock pool is used
+        if (args.has("pool-size") && !boost::atomics::set_lock_pool_size(args.get_unsigned("pool-size", 0u)))
+            throw std::runtime_error("Failed to set the lock pool size");
+
+        bench_params params;
+        params.ops = args.get_list("ops");
+        params.types = args.get_list("types");
+        params.layouts = args.get_list("layouts");
+        params.thread_counts = get_thread_counts(args.get_unsigned("threads", get_default_max_threads()));
+        params.object_count = args.get_unsigned("objects", 4096u);
+        params.duration = std::chrono::milliseconds(args.get_unsigned("duration", 100u));
+        params.report_buckets = args.has("buckets");
+
+        result_writer writer(std::cout, args.get_string("format", "csv"));
+
+        run_type< value< 8u > >(params, writer);
+        run_type< value< 16u > >(params, writer);
+        run_type< value< 32u > >(params, writer);
+        run_type< value< 64u > >(params, writer);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
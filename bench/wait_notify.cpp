@@ -0,0 +1,452 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures latencies of waiting and notifying operations in the following scenarios:
+//
+// - ping_pong: Pairs of threads pass control to each other by modifying an atomic object and notifying the other thread.
+//   The latency is the time of one handoff, which is half of the round trip time.
+// - fan_out: One thread modifies an atomic object and notifies all threads blocked on it. The latency is the time from
+//   the notification until a blocked thread wakes up.
+// - notify_no_waiters: Threads call notifying operations on atomic objects with no blocked threads. The latency is
+//   the duration of a notifying operation.
+//
+// The benchmark runs the scenarios for process-local and IPC atomic objects, which use different implementations
+// of waiting and notifying operations, depending on the platform and the object size. Compile the benchmark with
+// BOOST_ATOMIC_FORCE_FALLBACK defined to measure the lock pool-based implementation. To compare the lock pool
+// implementations based on futexes and pthread primitives, build Boost.Atomic with BOOST_ATOMIC_LOCK_POOL_USE_PTHREAD.
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
+#include <boost/atomic/lock_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/config.hpp>
+
+#include "bench_helpers.hpp"
+
+//! Benchmark parameters
+struct bench_params
+{
+    std::vector< std::string > scenarios;
+    std::vector< std::string > objects;
+    std::vector< std::string > types;
+    std::vector< unsigned int > thread_counts;
+    std::chrono::milliseconds duration;
+    std::chrono::microseconds block_delay;
+    boost::atomics::wait_spin_policy spin;
+    bool ipc_wait_table;
+    //! Memory for the atomic objects in the IPC wait table memory region, or \c nullptr if the IPC wait table is not used
+    void* ipc_object_area;
+    //! Size of the memory for the atomic objects in the IPC wait table memory region, in bytes
+    std::size_t ipc_object_area_size;
+};
+
+//! Number of notifying operations per latency sample in the notify_no_waiters scenario
+constexpr unsigned int notify_batch_size = 64u;
+
+template< typename T >
+struct type_name;
+
+template< >
+struct type_name< std::uint8_t > { static const char* get() noexcept { return "uint8"; } };
+template< >
+struct type_name< std::uint16_t > { static const char* get() noexcept { return "uint16"; } };
+template< >
+struct type_name< std::uint32_t > { static const char* get() noexcept { return "uint32"; } };
+template< >
+struct type_name< std::uint64_t > { static const char* get() noexcept { return "uint64"; } };
+#if defined(BOOST_HAS_INT128)
+template< >
+struct type_name< boost::uint128_type > { static const char* get() noexcept { return "uint128"; } };
+#endif
+
+template< template< typename > class Atomic >
+struct object_name;
+
+template< >
+struct object_name< boost::atomic > { static const char* get() noexcept { return "atomic"; } };
+template< >
+struct object_name< boost::ipc_atomic > { static const char* get() noexcept { return "ipc_atomic"; } };
+
+//! The trait indicates whether the atomic object type supports values of type \c T
+template< template< typename > class Atomic, typename T >
+struct is_supported : public std::true_type {};
+
+// Operations on IPC atomic objects are only supported if they are lock-free
+template< typename T >
+struct is_supported< boost::ipc_atomic, T > : public std::integral_constant< bool, boost::ipc_atomic< T >::is_always_lock_free > {};
+
+//! Calls the waiting operation with the spin policy specified in the parameters
+template< typename Atomic, typename T >
+BOOST_FORCEINLINE T wait(Atomic& a, T old_val, bench_params const& params) noexcept
+{
+    return a.wait(old_val, params.spin);
+}
+
+//! Constructs the atomic objects for a benchmark run. The objects are placed in the IPC wait table memory region, if the table is used.
+template< typename Atomic, typename T >
+std::unique_ptr< cache_aligned_array< Atomic > > make_atomics(bench_params const& params, std::size_t count)
+{
+    if (params.ipc_object_area != nullptr)
+        return std::unique_ptr< cache_aligned_array< Atomic > >(new cache_aligned_array< Atomic >(params.ipc_object_area, params.ipc_object_area_size, count, 0u, static_cast< T >(0u)));
+
+    return std::unique_ptr< cache_aligned_array< Atomic > >(new cache_aligned_array< Atomic >(count, 0u, static_cast< T >(0u)));
+}
+
+/*
+ * In the ping_pong and fan_out scenarios, the atomic object values cycle between 1 and 2. The value of 3 indicates
+ * the end of the run.
+ */
+
+template< typename Atomic, typename T >
+void run_ping_pong(bench_params const& params, unsigned int pair_count, latency_histogram& latencies)
+{
+    std::unique_ptr< cache_aligned_array< Atomic > > atomics_ptr = make_atomics< Atomic, T >(params, pair_count);
+    cache_aligned_array< Atomic >& atomics = *atomics_ptr;
+    cache_aligned_array< latency_histogram > histograms(pair_count, 0u);
+    run_control control;
+
+    std::vector< std::thread > threads;
+    threads.reserve(pair_count * 2u);
+    for (unsigned int i = 0u; i < pair_count; ++i)
+    {
+        threads.emplace_back([&atomics, &histograms, &control, &params, i]()
+        {
+            Atomic& a = atomics[i];
+            latency_histogram& histogram = histograms[i];
+            control.wait_for_start();
+            while (!control.is_stopped())
+            {
+                const std::uint64_t start_time = get_time_ns();
+                a.store(static_cast< T >(1u));
+                a.notify_one();
+                wait(a, static_cast< T >(1u), params);
+                histogram.add((get_time_ns() - start_time) / 2u);
+            }
+
+            a.store(static_cast< T >(3u));
+            a.notify_one();
+        });
+
+        threads.emplace_back([&atomics, &control, &params, i]()
+        {
+            Atomic& a = atomics[i];
+            T value = static_cast< T >(0u);
+            control.wait_for_start();
+            while (true)
+            {
+                value = wait(a, value, params);
+                if (value == static_cast< T >(3u))
+                    break;
+
+                value = static_cast< T >(2u);
+                a.store(value);
+                a.notify_one();
+            }
+        });
+    }
+
+    control.run(pair_count * 2u, params.duration);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (unsigned int i = 0u; i < pair_count; ++i)
+        latencies.merge(histograms[i]);
+}
+
+template< typename Atomic, typename T >
+void run_fan_out(bench_params const& params, unsigned int waiter_count, latency_histogram& latencies)
+{
+    std::unique_ptr< cache_aligned_array< Atomic > > atomics_ptr = make_atomics< Atomic, T >(params, 1u);
+    Atomic& a = (*atomics_ptr)[0];
+    std::atomic< unsigned int > ready_count(0u);
+    std::atomic< std::uint64_t > notify_time(0u);
+    cache_aligned_array< latency_histogram > histograms(waiter_count, 0u);
+    run_control control;
+
+    std::vector< std::thread > threads;
+    threads.reserve(waiter_count + 1u);
+    for (unsigned int i = 0u; i < waiter_count; ++i)
+    {
+        threads.emplace_back([&a, &ready_count, &notify_time, &histograms, &control, &params, i]()
+        {
+            latency_histogram& histogram = histograms[i];
+            T value = static_cast< T >(0u);
+            control.wait_for_start();
+            while (true)
+            {
+                ready_count.fetch_add(1u, std::memory_order_relaxed);
+                value = wait(a, value, params);
+                const std::uint64_t wake_time = get_time_ns();
+                if (value == static_cast< T >(3u))
+                    break;
+
+                histogram.add(wake_time - notify_time.load(std::memory_order_relaxed));
+            }
+        });
+    }
+
+    threads.emplace_back([&a, &ready_count, &notify_time, &control, &params, waiter_count]()
+    {
+        T value = static_cast< T >(0u);
+        control.wait_for_start();
+        while (true)
+        {
+            // Wait for all waiting threads to call the waiting operation and give them time to block
+            while (ready_count.load(std::memory_order_relaxed) < waiter_count && !control.is_stopped())
+                std::this_thread::yield();
+            if (control.is_stopped())
+                break;
+
+            std::this_thread::sleep_for(params.block_delay);
+
+            // The waiting threads can only increment the counter after the modification below
+            ready_count.store(0u, std::memory_order_relaxed);
+            value = static_cast< T >(value == static_cast< T >(1u) ? 2u : 1u);
+            notify_time.store(get_time_ns(), std::memory_order_relaxed);
+            // The seq_cst store below makes the notification time visible to the woken threads
+            a.store(value);
+            a.notify_all();
+        }
+
+        a.store(static_cast< T >(3u));
+        a.notify_all();
+    });
+
+    control.run(waiter_count + 1u, params.duration);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (unsigned int i = 0u; i < waiter_count; ++i)
+        latencies.merge(histograms[i]);
+}
+
+template< typename Atomic, typename T, bool NotifyAll >
+void run_notify_no_waiters(bench_params const& params, unsigned int thread_count, latency_histogram& latencies)
+{
+    std::unique_ptr< cache_aligned_array< Atomic > > atomics_ptr = make_atomics< Atomic, T >(params, thread_count);
+    cache_aligned_array< Atomic >& atomics = *atomics_ptr;
+    cache_aligned_array< latency_histogram > histograms(thread_count, 0u);
+    run_control control;
+
+    std::vector< std::thread > threads;
+    threads.reserve(thread_count);
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        threads.emplace_back([&atomics, &histograms, &control, i]()
+        {
+            Atomic& a = atomics[i];
+            latency_histogram& histogram = histograms[i];
+            control.wait_for_start();
+            while (!control.is_stopped())
+            {
+                const std::uint64_t start_time = get_time_ns();
+                for (unsigned int j = 0u; j < notify_batch_size; ++j)
+                {
+                    if (NotifyAll)
+                        a.notify_all();
+                    else
+                        a.notify_one();
+                }
+                histogram.add((get_time_ns() - start_time) / notify_batch_size);
+            }
+        });
+    }
+
+    control.run(thread_count, params.duration);
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (unsigned int i = 0u; i < thread_count; ++i)
+        latencies.merge(histograms[i]);
+}
+
+template< template< typename > class Atomic, typename T >
+void write_result(bench_params const& params, result_writer& writer, const char* scenario, const char* operation, unsigned int thread_count, latency_histogram const& latencies)
+{
+    std::unique_ptr< Atomic< T > > a(new Atomic< T >(static_cast< T >(0u)));
+
+    writer.write(std::vector< result_field >{
+        result_field("backend", get_backend_name()),
+        result_field("scenario", scenario),
+        result_field("operation", operation),
+        result_field("object", object_name< Atomic >::get()),
+        result_field("type", type_name< T >::get()),
+        result_field("size", static_cast< unsigned int >(sizeof(T))),
+        result_field("lock_free", static_cast< unsigned int >(a->is_lock_free())),
+        result_field("native_wait", static_cast< unsigned int >(a->has_native_wait_notify())),
+        result_field("ipc_wait_table", static_cast< unsigned int >(params.ipc_wait_table)),
+        result_field("spin", params.spin.max_iterations),
+        result_field("threads", thread_count),
+        result_field("samples", latencies.sample_count()),
+        result_field("mean_ns", latencies.mean()),
+        result_field("p50_ns", latencies.percentile(0.5)),
+        result_field("p99_ns", latencies.percentile(0.99)),
+        result_field("p999_ns", latencies.percentile(0.999)),
+        result_field("max_ns", latencies.max())
+    });
+}
+
+template< template< typename > class Atomic, typename T >
+void run_type(bench_params const& params, result_writer& writer, std::true_type)
+{
+
+    for (unsigned int thread_count : params.thread_counts)
+    {
+        if (is_selected(params.scenarios, "ping_pong"))
+        {
+            latency_histogram latencies;
+            run_ping_pong< Atomic< T >, T >(params, thread_count, latencies);
+            write_result< Atomic, T >(params, writer, "ping_pong", "wait", thread_count, latencies);
+        }
+
+        if (is_selected(params.scenarios, "fan_out"))
+        {
+            latency_histogram latencies;
+            run_fan_out< Atomic< T >, T >(params, thread_count, latencies);
+            write_result< Atomic, T >(params, writer, "fan_out", "wait", thread_count, latencies);
+        }
+
+        if (is_selected(params.scenarios, "notify_no_waiters"))
+        {
+            {
+                latency_histogram latencies;
+                run_notify_no_waiters< Atomic< T >, T, false >(params, thread_count, latencies);
+                write_result< Atomic, T >(params, writer, "notify_no_waiters", "notify_one", thread_count, latencies);
+            }
+            {
+                latency_histogram latencies;
+                run_notify_no_waiters< Atomic< T >, T, true >(params, thread_count, latencies);
+                write_result< Atomic, T >(params, writer, "notify_no_waiters", "notify_all", thread_count, latencies);
+            }
+        }
+    }
+}
+
+template< template< typename > class Atomic, typename T >
+inline void run_type(bench_params const&, result_writer&, std::false_type)
+{
+}
+
+template< template< typename > class Atomic, typename T >
+inline void run_type(bench_params const& params, result_writer& writer)
+{
+    if (is_selected(params.objects, object_name< Atomic >::get()) && is_selected(params.types, type_name< T >::get()))
+        run_type< Atomic, T >(params, writer, is_supported< Atomic, T >());
+}
+
+template< template< typename > class Atomic >
+void run_object(bench_params const& params, result_writer& writer)
+{
+    run_type< Atomic, std::uint8_t >(params, writer);
+    run_type< Atomic, std::uint16_t >(params, writer);
+    run_type< Atomic, std::uint32_t >(params, writer);
+    run_type< Atomic, std::uint64_t >(params, writer);
+#if defined(BOOST_HAS_INT128)
+    run_type< Atomic, boost::uint128_type >(params, writer);
+#endif
+}
+
+static void print_usage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+        "Options:\n"
+        "  --threads=N            Maximum number of thread pairs (ping_pong), waiting threads (fan_out) or notifying threads\n"
+        "                         (notify_no_waiters), the default is the number of hardware threads\n"
+        "  --duration=MS          Duration of each run, in milliseconds, the default is 200\n"
+        "  --scenarios=LIST       Comma-separated list of scenarios (ping_pong, fan_out, notify_no_waiters), the default is all scenarios\n"
+        "  --objects=LIST         Comma-separated list of atomic objects (atomic, ipc_atomic), the default is all objects\n"
+        "  --types=LIST           Comma-separated list of value types (uint8, uint16, uint32, uint64, uint128), the default is all types\n"
+        "  --spin=N               Number of spin iterations in waiting operations, the default is set by BOOST_ATOMIC_WAIT_SPIN_COUNT\n"
+        "  --block-delay=US       Delay before notifying in the fan_out scenario, in microseconds, the default is 100\n"
+        "  --ipc-wait-table       Attach an IPC wait table, which is used by waiting operations on IPC atomics without native support\n"
+        "  --format=csv|json      Output format, the default is csv\n";
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        command_line args(argc, argv);
+        if (args.has("help"))
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+
+        args.check_known({ "help", "threads", "duration", "scenarios", "objects", "types", "spin", "block-delay", "ipc-wait-table", "format" });
+
+        bench_params params;
+        params.scenarios = args.get_list("scenarios");
+        params.objects = args.get_list("objects");
+        params.types = args.get_list("types");
+        params.thread_counts = get_thread_counts(args.get_unsigned("threads", get_default_max_threads()));
+        params.duration = std::chrono::milliseconds(args.get_unsigned("duration", 200u));
+        params.block_delay = std::chrono::microseconds(args.get_unsigned("block-delay", 100u, 0u));
+        params.spin = boost::atomics::wait_spin_policy(args.get_unsigned("spin", boost::atomics::wait_spin_policy().max_iterations, 0u));
+        params.ipc_wait_table = args.has("ipc-wait-table");
+        params.ipc_object_area = nullptr;
+        params.ipc_object_area_size = 0u;
+
+        std::unique_ptr< std::max_align_t[] > ipc_wait_table;
+        if (params.ipc_wait_table)
+        {
+            const std::size_t table_size = boost::atomics::get_ipc_wait_table_size(256u);
+            if (table_size == 0u)
+                throw std::runtime_error("IPC wait tables are not supported on this platform");
+
+            // The atomic objects are placed after the table in the same memory region, one per cache line
+            unsigned int max_threads = 0u;
+            for (unsigned int thread_count : params.thread_counts)
+                max_threads = std::max(max_threads, thread_count);
+            params.ipc_object_area_size = (static_cast< std::size_t >(max_threads) + 1u) * bench_cache_line_size;
+
+            const std::size_t region_size = table_size + params.ipc_object_area_size;
+            ipc_wait_table.reset(new std::max_align_t[region_size / sizeof(std::max_align_t) + 1u]);
+            params.ipc_object_area = reinterpret_cast< unsigned char* >(ipc_wait_table.get()) + table_size;
+            if (!boost::atomics::create_ipc_wait_table(ipc_wait_table.get(), table_size, region_size) || !boost::atomics::attach_ipc_wait_table(ipc_wait_table.get()))
+                throw std::runtime_error("Failed to create an IPC wait table");
+        }
+
+        {
+            result_writer writer(std::cout, args.get_string("format", "csv"));
+
+            run_object< boost::atomic >(params, writer);
+            run_object< boost::ipc_atomic >(params, writer);
+        }
+
+        if (ipc_wait_table)
+        {
+            boost::atomics::detach_ipc_wait_table();
+            boost::atomics::destroy_ipc_wait_table(ipc_wait_table.get());
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,15 @@
+/*
+ *             Copyright Andrey Semashev 2025.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <immintrin.h>
+
+int main(int, char*[])
+{
+    __m256i mm = _mm256_set1_epi64x(0);
+    mm = _mm256_cmpeq_epi64(mm, mm);
+    return _mm256_movemask_pd(_mm256_castsi256_pd(mm)) + _mm256_testz_si256(mm, mm);
+}
@@ -0,0 +1,16 @@
+/*
+ *             Copyright Andrey Semashev 2025.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <immintrin.h>
+
+int main(int, char*[])
+{
+    long long data[8] = {};
+    __m512i mm = _mm512_set1_epi64(0);
+    __m512i mm2 = _mm512_maskz_loadu_epi64(static_cast< __mmask8 >(0x0F), data);
+    return static_cast< int >(_mm512_mask_cmpeq_epi64_mask(static_cast< __mmask8 >(0x0F), mm, mm2));
+}
@@ -14,14 +14,19 @@
 #include <boost/atomic/capabilities.hpp>
 #include <boost/atomic/posix_clock_traits_fwd.hpp>
 #include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
 #include <boost/atomic/atomic.hpp>
 #include <boost/atomic/atomic_ref.hpp>
 #include <boost/atomic/atomic_flag.hpp>
 #include <boost/atomic/ipc_atomic.hpp>
 #include <boost/atomic/ipc_atomic_ref.hpp>
 #include <boost/atomic/ipc_atomic_flag.hpp>
+#include <boost/atomic/waiter_tracking_atomic.hpp>
 #include <boost/atomic/thread_pause.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/fences.hpp>
+#include <boost/atomic/wait_any.hpp>
+#include <boost/atomic/lock_pool.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
 #pragma once
@@ -0,0 +1,126 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/cas_backoff.hpp
+ *
+ * This header contains definition of backoff policies used in compare-and-swap loops.
+ */
+
+#ifndef BOOST_ATOMIC_CAS_BACKOFF_HPP_INCLUDED_
+#define BOOST_ATOMIC_CAS_BACKOFF_HPP_INCLUDED_
+
+#include <cstdint>
+#include <boost/atomic/thread_pause.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+//! Backoff policy that is used in compare-and-swap loops of the library
+#define BOOST_ATOMIC_CAS_BACKOFF boost::atomics::exponential_backoff<>
+#endif
+
+namespace boost {
+namespace atomics {
+
+//! Backoff policy that retries compare-and-swap operations immediately
+struct no_backoff
+{
+    BOOST_FORCEINLINE void operator()() noexcept
+    {
+    }
+};
+
+/*!
+ * \brief Exponential backoff policy
+ *
+ * Every call executes \c thread_pause twice as many times as the previous call, up to \c MaxPauses times.
+ */
+template< unsigned int MaxPauses = 16u >
+class exponential_backoff
+{
+    static_assert(MaxPauses > 0u, "Boost.Atomic: exponential_backoff requires a non-zero number of pauses");
+
+private:
+    unsigned int m_pauses;
+
+public:
+    BOOST_FORCEINLINE exponential_backoff() noexcept : m_pauses(1u)
+    {
+    }
+
+    BOOST_FORCEINLINE void operator()() noexcept
+    {
+        for (unsigned int i = 0u; i < m_pauses; ++i)
+            atomics::thread_pause();
+
+        if (m_pauses < MaxPauses)
+            m_pauses *= 2u;
+    }
+};
+
+/*!
+ * \brief Randomized exponential backoff policy
+ *
+ * Every call executes \c thread_pause a pseudo-random number of times, between 1 and a limit that doubles with every call,
+ * up to \c MaxPauses. Randomization prevents threads that failed on the same atomic object from retrying in lockstep.
+ */
+template< unsigned int MaxPauses = 16u >
+class randomized_backoff
+{
+    static_assert(MaxPauses > 0u && (MaxPauses & (MaxPauses - 1u)) == 0u, "Boost.Atomic: randomized_backoff requires the number of pauses to be a power of two");
+
+private:
+    std::uint32_t m_state;
+    unsigned int m_limit;
+
+public:
+    BOOST_FORCEINLINE randomized_backoff() noexcept : m_state(0u), m_limit(1u)
+    {
+    }
+
+    BOOST_FORCEINLINE void operator()() noexcept
+    {
+        if (m_state == 0u)
+        {
+            // Seed the generator from the object address, which is different for different threads, as the object is normally on the stack
+            const std::uint64_t addr = static_cast< std::uint64_t >(reinterpret_cast< atomics::detail::uintptr_t >(this));
+            m_state = static_cast< std::uint32_t >((addr * 0x9E3779B97F4A7C15ull) >> 32u) | 1u;
+        }
+
+        // xorshift32
+        m_state ^= static_cast< std::uint32_t >(m_state << 13u);
+        m_state ^= static_cast< std::uint32_t >(m_state >> 17u);
+        m_state ^= static_cast< std::uint32_t >(m_state << 5u);
+
+        const unsigned int pauses = (static_cast< unsigned int >(m_state) & (m_limit - 1u)) + 1u;
+        for (unsigned int i = 0u; i < pauses; ++i)
+            atomics::thread_pause();
+
+        if (m_limit < MaxPauses)
+            m_limit *= 2u;
+    }
+};
+
+namespace detail {
+
+//! Backoff policy that is used in compare-and-swap loops
+using cas_backoff = BOOST_ATOMIC_CAS_BACKOFF;
+
+} // namespace detail
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_CAS_BACKOFF_HPP_INCLUDED_
@@ -22,9 +22,11 @@
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/core_operations.hpp>
 #include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/wait_spin.hpp>
 #include <boost/atomic/detail/aligned_variable.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -95,11 +97,16 @@ struct atomic_flag_impl
     }
 
     BOOST_FORCEINLINE bool wait(bool old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE bool wait(bool old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return !!wait_operations::wait(m_storage, static_cast< storage_type >(old_val), order);
+        return !!atomics::detail::wait_with_spin< wait_operations >(m_storage, static_cast< storage_type >(old_val), order, spin);
     }
 
     template< typename Clock, typename Duration >
@@ -107,12 +114,21 @@ struct atomic_flag_impl
     wait_until(bool old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< bool >
+    wait_until(bool old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(m_storage, static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(m_storage, static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< bool >(!!new_value, timed_out);
     }
 
@@ -121,12 +137,21 @@ struct atomic_flag_impl
     wait_for(bool old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< bool >
+    wait_for(bool old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(m_storage, static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(m_storage, static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< bool >(!!new_value, timed_out);
     }
 
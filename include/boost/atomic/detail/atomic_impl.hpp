@@ -23,13 +23,17 @@
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/intptr.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/bitwise_cast.hpp>
 #include <boost/atomic/detail/integral_conversions.hpp>
 #include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/lock_free_dispatch.hpp>
 #include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/wait_spin.hpp>
+#include <boost/atomic/detail/wait_any_fwd.hpp>
 #include <boost/atomic/detail/extra_operations.hpp>
 #include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/aligned_variable.hpp>
@@ -80,10 +84,13 @@ protected:
             core_operations::storage_alignment : atomics::detail::alignment_of< value_type >::value;
 
 public:
-    static constexpr bool is_always_lock_free = core_operations::is_always_lock_free;
+    static constexpr bool is_always_lock_free = atomics::detail::is_always_lock_free< core_operations >::value;
     static constexpr bool always_has_native_wait_notify = wait_operations::always_has_native_wait_notify;
 
 protected:
+    template< typename >
+    friend struct atomics::detail::wait_any_impl;
+
     BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(storage_alignment, storage_type, m_storage);
 
 public:
@@ -110,8 +117,9 @@ public:
     BOOST_FORCEINLINE bool is_lock_free() const volatile noexcept
     {
         // C++17 requires all instances of atomic<> return a value consistent with is_always_lock_free here.
-        // Boost.Atomic also enforces the required alignment of the atomic storage, so we can always return is_always_lock_free.
-        return is_always_lock_free;
+        // Boost.Atomic also enforces the required alignment of the atomic storage, so the result only depends on the CPU
+        // capabilities, if the core operations are selected at run time.
+        return atomics::detail::is_lock_free< core_operations >();
     }
 
     BOOST_FORCEINLINE bool has_native_wait_notify() const volatile noexcept
@@ -276,11 +284,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -288,12 +301,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -302,12 +324,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -550,11 +581,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -562,12 +598,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -576,12 +621,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -744,6 +798,36 @@ public:
         return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_complement(this->storage(), order));
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_max(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_min(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_add_sat(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_add_sat(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_add_sat(difference_type v, value_arg_type limit, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_add_sat(this->storage(), static_cast< storage_type >(v), static_cast< storage_type >(limit), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_sub_sat(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_sub_sat(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_sub_sat(difference_type v, value_arg_type limit, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::integral_truncate< value_type >(extra_operations::fetch_sub_sat(this->storage(), static_cast< storage_type >(v), static_cast< storage_type >(limit), order));
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         return atomics::detail::integral_truncate< value_type >(extra_operations::add(this->storage(), static_cast< storage_type >(v), order));
@@ -814,6 +898,16 @@ public:
         extra_operations::opaque_complement(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_operations::opaque_max(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_operations::opaque_min(this->storage(), static_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool add_and_test(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         return extra_operations::add_and_test(this->storage(), static_cast< storage_type >(v), order);
@@ -849,6 +943,21 @@ public:
         return extra_operations::complement_and_test(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE bool max_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_operations::max_and_test(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool min_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_operations::min_and_test(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool sub_if_ge(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_operations::sub_if_ge(this->storage(), static_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool bit_test_and_set(unsigned int bit_number, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         BOOST_ASSERT(bit_number < sizeof(value_type) * 8u);
@@ -914,11 +1023,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::integral_truncate< value_type >(wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order));
+        return atomics::detail::integral_truncate< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -926,12 +1040,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::integral_truncate< value_type >(new_value), timed_out);
     }
 
@@ -940,12 +1063,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::integral_truncate< value_type >(new_value), timed_out);
     }
 
@@ -1070,11 +1202,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return !!wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order);
+        return !!atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin);
     }
 
     template< typename Clock, typename Duration >
@@ -1082,12 +1219,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(!!new_value, timed_out);
     }
 
@@ -1096,12 +1242,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(!!new_value, timed_out);
     }
 
@@ -1251,6 +1406,16 @@ public:
         return extra_fp_operations::fetch_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_fp_operations::fetch_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_fp_operations::fetch_min(this->storage(), v, order);
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         return extra_fp_operations::add(this->storage(), v, order);
@@ -1281,6 +1446,16 @@ public:
         extra_fp_operations::opaque_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_fp_operations::opaque_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_fp_operations::opaque_min(this->storage(), v, order);
+    }
+
     // Operators
     BOOST_FORCEINLINE value_type operator+=(difference_type v) volatile noexcept
     {
@@ -1293,11 +1468,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_fp_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_fp_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -1305,12 +1485,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_fp_cast< value_type >(new_value), timed_out);
     }
 
@@ -1319,12 +1508,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_fp_cast< value_type >(new_value), timed_out);
     }
 
@@ -1488,6 +1686,18 @@ public:
             extra_operations::sub(this->storage(), static_cast< uintptr_storage_type >(v * sizeof(T)), order)));
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(static_cast< uintptr_storage_type >(
+            extra_operations::fetch_max(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order)));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(static_cast< uintptr_storage_type >(
+            extra_operations::fetch_min(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order)));
+    }
+
     BOOST_FORCEINLINE void opaque_add(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         extra_operations::opaque_add(this->storage(), static_cast< uintptr_storage_type >(v * sizeof(T)), order);
@@ -1498,6 +1708,16 @@ public:
         extra_operations::opaque_sub(this->storage(), static_cast< uintptr_storage_type >(v * sizeof(T)), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_operations::opaque_max(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        extra_operations::opaque_min(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool add_and_test(difference_type v, memory_order order = memory_order_seq_cst) volatile noexcept
     {
         return extra_operations::add_and_test(this->storage(), static_cast< uintptr_storage_type >(v * sizeof(T)), order);
@@ -1508,6 +1728,16 @@ public:
         return extra_operations::sub_and_test(this->storage(), static_cast< uintptr_storage_type >(v * sizeof(T)), order);
     }
 
+    BOOST_FORCEINLINE bool max_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_operations::max_and_test(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool min_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) volatile noexcept
+    {
+        return extra_operations::min_and_test(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(v), order);
+    }
+
     // Operators
     BOOST_FORCEINLINE value_type operator++(int) volatile noexcept
     {
@@ -1540,12 +1770,17 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         return atomics::detail::bitwise_cast< value_type >(static_cast< uintptr_storage_type >(
-            wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), order)));
+            atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), order, spin)));
     }
 
     template< typename Clock, typename Duration >
@@ -1553,12 +1788,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -1567,12 +1811,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< uintptr_storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
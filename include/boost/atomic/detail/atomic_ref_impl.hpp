@@ -21,12 +21,16 @@
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
 #include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/addressof.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/bitwise_cast.hpp>
 #include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/lock_free_dispatch.hpp>
 #include <boost/atomic/detail/wait_operations.hpp>
+#include <boost/atomic/detail/wait_spin.hpp>
+#include <boost/atomic/detail/wait_any_fwd.hpp>
 #include <boost/atomic/detail/extra_operations.hpp>
 #include <boost/atomic/detail/core_operations_emulated.hpp>
 #include <boost/atomic/detail/memory_order_utils.hpp>
@@ -84,10 +88,13 @@ public:
     static constexpr std::size_t required_alignment =
         atomics::detail::alignment_of< value_type >::value <= core_operations::storage_alignment ?
             core_operations::storage_alignment : atomics::detail::alignment_of< value_type >::value;
-    static constexpr bool is_always_lock_free = core_operations::is_always_lock_free;
+    static constexpr bool is_always_lock_free = atomics::detail::is_always_lock_free< core_operations >::value;
     static constexpr bool always_has_native_wait_notify = wait_operations::always_has_native_wait_notify;
 
 protected:
+    template< typename >
+    friend struct atomics::detail::wait_any_impl;
+
     value_type* m_value;
 
 public:
@@ -110,7 +117,7 @@ public:
         // C++20 specifies that is_lock_free returns true if operations on *all* objects of the atomic_ref<T> type are lock-free.
         // This does not allow to return true or false depending on the referenced object runtime alignment. Currently, Boost.Atomic
         // follows this specification, although we may support runtime alignment checking in the future.
-        return is_always_lock_free;
+        return atomics::detail::is_lock_free< core_operations >();
     }
 
     BOOST_FORCEINLINE bool has_native_wait_notify() const noexcept
@@ -226,11 +233,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -238,12 +250,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -252,12 +273,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -496,11 +526,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -508,12 +543,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -522,12 +566,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -688,6 +741,36 @@ public:
         return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_complement(this->storage(), order));
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_max(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_min(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_add_sat(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_add_sat(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_add_sat(difference_type v, value_arg_type limit, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_add_sat(this->storage(), static_cast< storage_type >(v), static_cast< storage_type >(limit), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_sub_sat(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_sub_sat(this->storage(), static_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_sub_sat(difference_type v, value_arg_type limit, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_sub_sat(this->storage(), static_cast< storage_type >(v), static_cast< storage_type >(limit), order));
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
     {
         return atomics::detail::bitwise_cast< value_type >(extra_operations::add(this->storage(), static_cast< storage_type >(v), order));
@@ -758,6 +841,16 @@ public:
         extra_operations::opaque_complement(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_operations::opaque_max(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_operations::opaque_min(this->storage(), static_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool add_and_test(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
     {
         return extra_operations::add_and_test(this->storage(), static_cast< storage_type >(v), order);
@@ -793,6 +886,21 @@ public:
         return extra_operations::complement_and_test(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE bool max_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_operations::max_and_test(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool min_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_operations::min_and_test(this->storage(), static_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool sub_if_ge(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_operations::sub_if_ge(this->storage(), static_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool bit_test_and_set(unsigned int bit_number, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(bit_number < sizeof(value_type) * 8u);
@@ -858,11 +966,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -870,12 +983,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -884,12 +1006,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -1012,11 +1143,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return !!wait_operations::wait(this->storage(), static_cast< storage_type >(old_val), order);
+        return !!atomics::detail::wait_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), order, spin);
     }
 
     template< typename Clock, typename Duration >
@@ -1024,12 +1160,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(!!new_value, timed_out);
     }
 
@@ -1038,12 +1183,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), static_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), static_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(!!new_value, timed_out);
     }
 
@@ -1195,6 +1349,16 @@ public:
         return extra_fp_operations::fetch_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_fp_operations::fetch_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_fp_operations::fetch_min(this->storage(), v, order);
+    }
+
     BOOST_FORCEINLINE value_type add(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
     {
         return extra_fp_operations::add(this->storage(), v, order);
@@ -1225,6 +1389,16 @@ public:
         extra_fp_operations::opaque_negate(this->storage(), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_fp_operations::opaque_max(this->storage(), v, order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_fp_operations::opaque_min(this->storage(), v, order);
+    }
+
     // Operators
     BOOST_FORCEINLINE value_type operator+=(difference_type v) const noexcept
     {
@@ -1237,11 +1411,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_fp_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_fp_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -1249,12 +1428,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_fp_cast< value_type >(new_value), timed_out);
     }
 
@@ -1263,12 +1451,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_fp_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_fp_cast< value_type >(new_value), timed_out);
     }
 
@@ -1429,6 +1626,16 @@ public:
         return atomics::detail::bitwise_cast< value_type >(extra_operations::sub(this->storage(), static_cast< storage_type >(v * sizeof(T)), order));
     }
 
+    BOOST_FORCEINLINE value_type fetch_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_max(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order));
+    }
+
+    BOOST_FORCEINLINE value_type fetch_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(extra_operations::fetch_min(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order));
+    }
+
     BOOST_FORCEINLINE void opaque_add(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
     {
         extra_operations::opaque_add(this->storage(), static_cast< storage_type >(v * sizeof(T)), order);
@@ -1439,6 +1646,16 @@ public:
         extra_operations::opaque_sub(this->storage(), static_cast< storage_type >(v * sizeof(T)), order);
     }
 
+    BOOST_FORCEINLINE void opaque_max(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_operations::opaque_max(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE void opaque_min(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        extra_operations::opaque_min(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order);
+    }
+
     BOOST_FORCEINLINE bool add_and_test(difference_type v, memory_order order = memory_order_seq_cst) const noexcept
     {
         return extra_operations::add_and_test(this->storage(), static_cast< storage_type >(v * sizeof(T)), order);
@@ -1449,6 +1666,16 @@ public:
         return extra_operations::sub_and_test(this->storage(), static_cast< storage_type >(v * sizeof(T)), order);
     }
 
+    BOOST_FORCEINLINE bool max_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_operations::max_and_test(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order);
+    }
+
+    BOOST_FORCEINLINE bool min_and_test(value_arg_type v, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return extra_operations::min_and_test(this->storage(), atomics::detail::bitwise_cast< storage_type >(v), order);
+    }
+
     // Operators
     BOOST_FORCEINLINE value_type operator++(int) const noexcept
     {
@@ -1481,11 +1708,16 @@ public:
     }
 
     BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const noexcept
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
-        return atomics::detail::bitwise_cast< value_type >(wait_operations::wait(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order));
+        return atomics::detail::bitwise_cast< value_type >(atomics::detail::wait_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), order, spin));
     }
 
     template< typename Clock, typename Duration >
@@ -1493,12 +1725,21 @@ public:
     wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_until(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_until(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_until(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_until_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -1507,12 +1748,21 @@ public:
     wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const
         noexcept(noexcept(wait_operations::wait_for(
             std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(wait_operations::wait_for(
+            std::declval< storage_type const volatile& >(), std::declval< storage_type >(), timeout, order, std::declval< bool& >())))
     {
         BOOST_ASSERT(order != memory_order_release);
         BOOST_ASSERT(order != memory_order_acq_rel);
 
         bool timed_out = false;
-        storage_type new_value = wait_operations::wait_for(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, timed_out);
+        storage_type new_value = atomics::detail::wait_for_with_spin< wait_operations >(this->storage(), atomics::detail::bitwise_cast< storage_type >(old_val), timeout, order, spin, timed_out);
         return wait_result< value_type >(atomics::detail::bitwise_cast< value_type >(new_value), timed_out);
     }
 
@@ -34,6 +34,9 @@
 
 #if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
 #define BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B 1
+#elif defined(__x86_64__) && !defined(BOOST_ATOMIC_NO_CMPXCHG16B)
+// The target CPU may not support cmpxchg16b (e.g. some early AMD64 CPUs), detect its presence at run time
+#define BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B 1
 #endif
 
 #if defined(__x86_64__) || defined(__SSE2__)
@@ -65,6 +68,8 @@
 #endif
 #if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
 #define BOOST_ATOMIC_INT128_LOCK_FREE 2
+#elif defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
+#define BOOST_ATOMIC_INT128_LOCK_FREE 1
 #endif
 #define BOOST_ATOMIC_POINTER_LOCK_FREE 2
 
@@ -15,6 +15,7 @@
 #define BOOST_ATOMIC_DETAIL_CAS_BASED_EXCHANGE_HPP_INCLUDED_
 
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -36,7 +37,9 @@ struct cas_based_exchange :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 };
@@ -22,12 +22,19 @@
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/core_arch_operations_fwd.hpp>
 #include <boost/atomic/detail/capabilities.hpp>
-#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG8B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
+#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG8B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
 #include <cstdint>
 #include <boost/atomic/detail/intptr.hpp>
 #include <boost/atomic/detail/string_ops.hpp>
 #include <boost/atomic/detail/core_ops_cas_based.hpp>
 #endif
+#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
+#include <boost/atomic/detail/x86_cpu_features.hpp>
+#endif
+#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
+#include <boost/assert.hpp>
+#include <boost/atomic/detail/core_operations_emulated.hpp>
+#endif
 #include <boost/atomic/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -917,14 +924,14 @@ struct core_arch_operations< 8u, Signed, Interprocess > :
 
 #endif
 
-#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
+#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
 
 template< bool Signed, bool Interprocess >
 struct gcc_dcas_x86_64
 {
     using storage_type = typename storage_traits< 16u >::type;
     using aliasing_uint64_t = std::uint64_t BOOST_ATOMIC_DETAIL_MAY_ALIAS;
-#if defined(__AVX__)
+#if defined(__SSE2__)
     using xmm_t = std::uint64_t __attribute__((__vector_size__(16)));
 #endif
 
@@ -935,15 +942,27 @@ struct gcc_dcas_x86_64
     static constexpr bool full_cas_based = true;
     static constexpr bool is_always_lock_free = true;
 
+#if defined(__SSE2__)
+    //! Returns \c true if aligned 16-byte vector loads and stores are atomic on the current CPU
+    static BOOST_FORCEINLINE bool has_atomic_vector_moves() noexcept
+    {
+#if defined(__AVX__)
+        return true;
+#else
+        return (atomics::detail::get_x86_cpu_features() & x86_cpu_features::avx) != 0u;
+#endif
+    }
+#endif // defined(__SSE2__)
+
     static BOOST_FORCEINLINE void store(storage_type volatile& storage, storage_type v, memory_order order) noexcept
     {
         BOOST_ATOMIC_DETAIL_TSAN_RELEASE(&storage, order);
 
-#if defined(__AVX__)
-        if (BOOST_LIKELY(order != memory_order_seq_cst && (((uintptr_t)&storage) & 15u) == 0u))
+#if defined(__SSE2__)
+        if (BOOST_LIKELY(order != memory_order_seq_cst && (((uintptr_t)&storage) & 15u) == 0u && has_atomic_vector_moves()))
         {
             // According to SDM Volume 3, 8.1.1 Guaranteed Atomic Operations, processors supporting AVX guarantee
-            // aligned vector moves to be atomic.
+            // aligned vector moves to be atomic. This includes legacy SSE moves, which are used if the code is not compiled for AVX.
 #if defined(BOOST_HAS_INT128)
             xmm_t value = { static_cast< std::uint64_t >(v), static_cast< std::uint64_t >(v >> 64u) };
 #else
@@ -952,7 +971,11 @@ struct gcc_dcas_x86_64
 #endif
             __asm__ __volatile__
             (
+#if defined(__AVX__)
                 "vmovdqa %[value], %[storage]\n\t"
+#else
+                "movdqa %[value], %[storage]\n\t"
+#endif
                 : [storage] "=m" (storage)
                 : [value] "x" (value)
                 : "memory"
@@ -960,7 +983,7 @@ struct gcc_dcas_x86_64
 
             return;
         }
-#endif // defined(__AVX__)
+#endif // defined(__SSE2__)
 
         __asm__ __volatile__
         (
@@ -977,15 +1000,20 @@ struct gcc_dcas_x86_64
 
     static BOOST_FORCEINLINE storage_type load(storage_type const volatile& storage, memory_order order) noexcept
     {
-#if defined(__AVX__)
-        if (BOOST_LIKELY((((uintptr_t)&storage) & 15u) == 0u))
+#if defined(__SSE2__)
+        if (BOOST_LIKELY((((uintptr_t)&storage) & 15u) == 0u && has_atomic_vector_moves()))
         {
             // According to SDM Volume 3, 8.1.1 Guaranteed Atomic Operations, processors supporting AVX guarantee
-            // aligned vector moves to be atomic.
+            // aligned vector moves to be atomic. Unlike cmpxchg16b, the load does not acquire the cache line for exclusive ownership,
+            // which allows concurrent loads to not contend with each other.
             xmm_t v;
             __asm__ __volatile__
             (
+#if defined(__AVX__)
                 "vmovdqa %[storage], %[value]\n\t"
+#else
+                "movdqa %[storage], %[value]\n\t"
+#endif
                 : [value] "=x" (v)
                 : [storage] "m" (storage)
                 : "memory"
@@ -1001,7 +1029,7 @@ struct gcc_dcas_x86_64
             BOOST_ATOMIC_DETAIL_TSAN_ACQUIRE(&storage, order);
             return value;
         }
-#endif // defined(__AVX__)
+#endif // defined(__SSE2__)
 
         // Note that despite const qualification cmpxchg16b below may issue a store to the storage. The storage value
         // will not change, but this prevents the storage to reside in read-only memory.
@@ -1056,7 +1084,7 @@ struct gcc_dcas_x86_64
     {
         BOOST_ATOMIC_DETAIL_TSAN_RELEASE(&storage, success_order);
 
-#if defined(__clang__)
+#if defined(__clang__) && defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
 
         // Clang cannot allocate rax:rdx register pairs but it has sync intrinsics
         storage_type old_expected = expected;
@@ -1065,7 +1093,8 @@ struct gcc_dcas_x86_64
 
 #elif defined(BOOST_ATOMIC_DETAIL_X86_NO_ASM_AX_DX_PAIRS)
 
-        // Some compilers can't allocate rax:rdx register pair either but also don't support 128-bit __sync_val_compare_and_swap
+        // Some compilers can't allocate rax:rdx register pair either but also don't support 128-bit __sync_val_compare_and_swap.
+        // The intrinsic is also not usable if cmpxchg16b is not enabled at compile time.
         bool success;
         __asm__ __volatile__
         (
@@ -1160,12 +1189,101 @@ struct gcc_dcas_x86_64
     }
 };
 
+#endif // defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B) || defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
+
+#if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
+
 template< bool Signed, bool Interprocess >
 struct core_arch_operations< 16u, Signed, Interprocess > :
     public core_operations_cas_based< gcc_dcas_x86_64< Signed, Interprocess > >
 {
 };
 
+#elif defined(BOOST_ATOMIC_DETAIL_X86_HAS_DYNAMIC_CMPXCHG16B)
+
+/*!
+ * \brief Double-width CAS operations that use cmpxchg16b if it is supported by the CPU, or the lock pool otherwise
+ *
+ * The implementation is selected at run time, and the selection is the same for all atomic objects in the process.
+ * Since other operations are implemented on top of CAS, they are consistent with the selected implementation.
+ */
+template< bool Signed, bool Interprocess >
+struct gcc_dcas_x86_64_dispatch
+{
+    using lock_free_operations = gcc_dcas_x86_64< Signed, Interprocess >;
+    // Inter-process operations require cmpxchg16b, the lock-based implementation is only used for process-local objects
+    using lock_based_operations = core_operations_emulated< 16u, 16u, Signed, false >;
+    // Both implementations use storage_traits< 16u >::type as the storage type
+    using storage_type = typename lock_free_operations::storage_type;
+
+    static constexpr std::size_t storage_size = 16u;
+    static constexpr std::size_t storage_alignment = 16u;
+    static constexpr bool is_signed = Signed;
+    static constexpr bool is_interprocess = Interprocess;
+    static constexpr bool full_cas_based = true;
+    // The operations are not always lock-free, but the operations implemented on top of them must not use the lock pool directly.
+    // See has_lock_free_dispatch.
+    static constexpr bool is_always_lock_free = true;
+
+    static BOOST_FORCEINLINE bool is_lock_free() noexcept
+    {
+        return (atomics::detail::get_x86_cpu_features() & x86_cpu_features::cmpxchg16b) != 0u;
+    }
+
+    static BOOST_FORCEINLINE void store(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        if (BOOST_LIKELY(is_lock_free()))
+        {
+            lock_free_operations::store(storage, v, order);
+        }
+        else
+        {
+            BOOST_ASSERT_MSG(!Interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+            lock_based_operations::store(storage, v, order);
+        }
+    }
+
+    static BOOST_FORCEINLINE storage_type load(storage_type const volatile& storage, memory_order order) noexcept
+    {
+        if (BOOST_LIKELY(is_lock_free()))
+            return lock_free_operations::load(storage, order);
+
+        BOOST_ASSERT_MSG(!Interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        return lock_based_operations::load(storage, order);
+    }
+
+    static BOOST_FORCEINLINE bool compare_exchange_strong(
+        storage_type volatile& storage, storage_type& expected, storage_type desired, memory_order success_order, memory_order failure_order) noexcept
+    {
+        if (BOOST_LIKELY(is_lock_free()))
+            return lock_free_operations::compare_exchange_strong(storage, expected, desired, success_order, failure_order);
+
+        BOOST_ASSERT_MSG(!Interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        return lock_based_operations::compare_exchange_strong(storage, expected, desired, success_order, failure_order);
+    }
+
+    static BOOST_FORCEINLINE bool compare_exchange_weak(
+        storage_type volatile& storage, storage_type& expected, storage_type desired, memory_order success_order, memory_order failure_order) noexcept
+    {
+        return compare_exchange_strong(storage, expected, desired, success_order, failure_order);
+    }
+
+    static BOOST_FORCEINLINE storage_type exchange(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        if (BOOST_LIKELY(is_lock_free()))
+            return lock_free_operations::exchange(storage, v, order);
+
+        BOOST_ASSERT_MSG(!Interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        return lock_based_operations::exchange(storage, v, order);
+    }
+};
+
+template< bool Signed, bool Interprocess >
+struct core_arch_operations< 16u, Signed, Interprocess > :
+    public core_operations_cas_based< gcc_dcas_x86_64_dispatch< Signed, Interprocess > >
+{
+};
+
 #endif // defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B)
 
 } // namespace detail
@@ -73,11 +73,13 @@ struct core_operations_emulated :
         const_cast< storage_type& >(storage) = v;
     }
 
-    static storage_type load(storage_type const volatile& storage, memory_order) noexcept
+    static storage_type load(storage_type const volatile& storage, memory_order order) noexcept
     {
         static_assert(!is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        scoped_lock lock(&storage);
-        return const_cast< storage_type const& >(storage);
+        // Loads are implemented as seqlock readers, which allows concurrent loads to not contend on the lock
+        storage_type v;
+        lock_pool::load(lock_pool::hash_ptr< storage_alignment >(&storage), &storage, &v, sizeof(storage_type), order);
+        return v;
     }
 
     static storage_type fetch_add(storage_type volatile& storage, storage_type v, memory_order) noexcept
@@ -15,6 +15,7 @@
 #define BOOST_ATOMIC_DETAIL_CORE_OPS_CAS_BASED_HPP_INCLUDED_
 
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -38,7 +39,9 @@ struct core_operations_cas_based :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val + v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, old_val + v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 
@@ -46,7 +49,9 @@ struct core_operations_cas_based :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val - v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, old_val - v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 
@@ -54,7 +59,9 @@ struct core_operations_cas_based :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val & v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, old_val & v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 
@@ -62,7 +69,9 @@ struct core_operations_cas_based :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val | v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, old_val | v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 
@@ -70,7 +79,9 @@ struct core_operations_cas_based :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        while (!Base::compare_exchange_weak(storage, old_val, old_val ^ v, order, memory_order_relaxed)) {}
+        atomics::detail::cas_backoff backoff;
+        while (!Base::compare_exchange_weak(storage, old_val, old_val ^ v, order, memory_order_relaxed))
+            backoff();
         return old_val;
     }
 
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/integral_conversions.hpp>
@@ -41,11 +42,12 @@ struct extending_cas_based_arithmetic :
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
         storage_type new_val;
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val + v));
+            if (Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return old_val;
     }
 
@@ -54,11 +56,12 @@ struct extending_cas_based_arithmetic :
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
         storage_type new_val;
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val - v));
+            if (Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!Base::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return old_val;
     }
 };
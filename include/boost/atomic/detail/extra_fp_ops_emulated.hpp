@@ -18,6 +18,7 @@
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/bitwise_fp_cast.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/extra_fp_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -100,6 +101,48 @@ struct extra_fp_operations_emulated :
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
         base_type::fetch_sub(storage, v, order);
     }
+
+    static value_type fetch_max(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not less than v
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(base_type::load(storage, atomics::detail::deduce_failure_order(order)));
+        if (old_val < v)
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = atomics::detail::bitwise_fp_cast< value_type >(s);
+            if (old_val < v)
+                s = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        }
+        return old_val;
+    }
+
+    static value_type fetch_min(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not greater than v
+        value_type old_val = atomics::detail::bitwise_fp_cast< value_type >(base_type::load(storage, atomics::detail::deduce_failure_order(order)));
+        if (v < old_val)
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = atomics::detail::bitwise_fp_cast< value_type >(s);
+            if (v < old_val)
+                s = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        fetch_min(storage, v, order);
+    }
 };
 
 template< typename Base, typename Value, std::size_t Size >
@@ -16,9 +16,11 @@
 
 #include <cstddef>
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/bitwise_fp_cast.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/extra_fp_operations_fwd.hpp>
 #include <boost/atomic/detail/type_traits/is_iec559.hpp>
 #include <boost/atomic/detail/type_traits/is_integral.hpp>
@@ -59,13 +61,14 @@ struct extra_fp_negate_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = -old_val;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return old_val;
     }
 
@@ -74,13 +77,14 @@ struct extra_fp_negate_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = -old_val;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -136,13 +140,14 @@ struct extra_fp_operations_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = old_val + v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -151,13 +156,14 @@ struct extra_fp_operations_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = old_val - v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -170,6 +176,52 @@ struct extra_fp_operations_generic :
     {
         base_type::fetch_sub(storage, v, order);
     }
+
+    static BOOST_FORCEINLINE value_type fetch_max(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not less than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        const storage_type new_storage = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        storage_type old_storage = base_type::load(storage, load_order);
+        value_type old_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+            if (!(old_val < v))
+                break;
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE value_type fetch_min(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not greater than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        const storage_type new_storage = atomics::detail::bitwise_fp_cast< storage_type >(v);
+        storage_type old_storage = base_type::load(storage, load_order);
+        value_type old_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
+            if (!(v < old_val))
+                break;
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, value_type v, memory_order order) noexcept
+    {
+        fetch_min(storage, v, order);
+    }
 };
 
 // Default extra_fp_operations template definition will be used unless specialized for a specific platform
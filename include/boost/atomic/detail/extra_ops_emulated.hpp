@@ -18,6 +18,8 @@
 #include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
+#include <boost/atomic/detail/integral_conversions.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/extra_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -240,6 +242,150 @@ struct extra_operations_emulated :
         storage_type old_val = base_type::fetch_xor(storage, mask, order);
         return !!(old_val & mask);
     }
+
+    static storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not less than v
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_less< storage_type, Signed >(old_val, v))
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            if (atomics::detail::integral_less< storage_type, Signed >(old_val, v))
+                s = v;
+        }
+        return old_val;
+    }
+
+    static storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not greater than v
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_less< storage_type, Signed >(v, old_val))
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            if (atomics::detail::integral_less< storage_type, Signed >(v, old_val))
+                s = v;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_min(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE bool max_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_max(storage, v, order);
+        return !!(atomics::detail::integral_less< storage_type, Signed >(old_val, v) ? v : old_val);
+    }
+
+    static BOOST_FORCEINLINE bool min_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_min(storage, v, order);
+        return !!(atomics::detail::integral_less< storage_type, Signed >(v, old_val) ? v : old_val);
+    }
+
+    static storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the result saturates to the atomic object value
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_add_sat< storage_type, Signed >(old_val, v) != old_val)
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            s = atomics::detail::integral_add_sat< storage_type, Signed >(old_val, v);
+        }
+        return old_val;
+    }
+
+    static storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not less than limit
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_less< storage_type, Signed >(old_val, limit))
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            if (atomics::detail::integral_less< storage_type, Signed >(old_val, limit))
+            {
+                storage_type new_val = atomics::detail::integral_add_sat< storage_type, Signed >(old_val, v);
+                if (atomics::detail::integral_less< storage_type, Signed >(limit, new_val))
+                    new_val = limit;
+                s = new_val;
+            }
+        }
+        return old_val;
+    }
+
+    static storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the result saturates to the atomic object value
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_sub_sat< storage_type, Signed >(old_val, v) != old_val)
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            s = atomics::detail::integral_sub_sat< storage_type, Signed >(old_val, v);
+        }
+        return old_val;
+    }
+
+    static storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is not greater than limit
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_less< storage_type, Signed >(limit, old_val))
+        {
+            storage_type& s = const_cast< storage_type& >(storage);
+            scoped_lock lock(&storage);
+            old_val = s;
+            if (atomics::detail::integral_less< storage_type, Signed >(limit, old_val))
+            {
+                storage_type new_val = atomics::detail::integral_sub_sat< storage_type, Signed >(old_val, v);
+                if (atomics::detail::integral_less< storage_type, Signed >(new_val, limit))
+                    new_val = limit;
+                s = new_val;
+            }
+        }
+        return old_val;
+    }
+
+    static bool sub_if_ge(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
+        // Loads don't lock the lock pool, so avoid locking if the atomic object value is less than v
+        storage_type old_val = base_type::load(storage, atomics::detail::deduce_failure_order(order));
+        if (atomics::detail::integral_less< storage_type, Signed >(old_val, v))
+            return false;
+
+        storage_type& s = const_cast< storage_type& >(storage);
+        scoped_lock lock(&storage);
+        old_val = s;
+        if (atomics::detail::integral_less< storage_type, Signed >(old_val, v))
+            return false;
+        // For signed types, v may be negative, in which case the result is clamped at the max value
+        s = atomics::detail::integral_sub_sat< storage_type, Signed >(old_val, v);
+        return true;
+    }
 };
 
 template< typename Base, std::size_t Size, bool Signed >
@@ -16,9 +16,11 @@
 
 #include <cstddef>
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
 #include <boost/atomic/detail/integral_conversions.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
 #include <boost/atomic/detail/extra_operations_fwd.hpp>
 #include <boost/atomic/detail/header.hpp>
 
@@ -43,9 +45,11 @@ struct extra_operations_generic :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
+        atomics::detail::cas_backoff backoff;
         while (!base_type::compare_exchange_weak(
             storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed))
         {
+            backoff();
         }
         return old_val;
     }
@@ -54,11 +58,12 @@ struct extra_operations_generic :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -193,6 +198,149 @@ struct extra_operations_generic :
         storage_type old_val = base_type::fetch_xor(storage, mask, order);
         return !!(old_val & mask);
     }
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not less than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        atomics::detail::cas_backoff backoff;
+        while (atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v) &&
+            !base_type::compare_exchange_weak(storage, old_val, v, order, load_order))
+        {
+            backoff();
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not greater than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        atomics::detail::cas_backoff backoff;
+        while (atomics::detail::integral_less< emulated_storage_type, Signed >(v, old_val) &&
+            !base_type::compare_exchange_weak(storage, old_val, v, order, load_order))
+        {
+            backoff();
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_min(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE bool max_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_max(storage, v, order);
+        return !!static_cast< emulated_storage_type >(atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v) ? v : old_val);
+    }
+
+    static BOOST_FORCEINLINE bool min_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_min(storage, v, order);
+        return !!static_cast< emulated_storage_type >(atomics::detail::integral_less< emulated_storage_type, Signed >(v, old_val) ? v : old_val);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if the result saturates to its current value, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            new_val = atomics::detail::integral_add_sat< emulated_storage_type, Signed >(old_val, v);
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not less than limit, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (!atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, limit))
+                break;
+            new_val = atomics::detail::integral_add_sat< emulated_storage_type, Signed >(old_val, v);
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(limit, new_val))
+                new_val = limit;
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if the result saturates to its current value, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            new_val = atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v);
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not greater than limit, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (!atomics::detail::integral_less< emulated_storage_type, Signed >(limit, old_val))
+                break;
+            new_val = atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v);
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(new_val, limit))
+                new_val = limit;
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE bool sub_if_ge(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is less than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v))
+                return false;
+            // For signed types, v may be negative, in which case the result is clamped at the max value
+            if (base_type::compare_exchange_weak(
+                storage, old_val, atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v), order, load_order))
+                break;
+        }
+        return true;
+    }
 };
 
 //! Specialization for cases when the platform only natively supports CAS
@@ -208,9 +356,11 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val;
         atomics::detail::non_atomic_load(storage, old_val);
+        atomics::detail::cas_backoff backoff;
         while (!base_type::compare_exchange_weak(
             storage, old_val, atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val)), order, memory_order_relaxed))
         {
+            backoff();
         }
         return old_val;
     }
@@ -219,11 +369,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(-old_val));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -231,11 +382,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val + v));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -243,11 +395,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val - v));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -255,11 +408,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val & v));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -267,11 +421,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val | v));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -279,11 +434,12 @@ struct extra_operations_generic< Base, Size, Signed, true > :
     {
         storage_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_val);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             new_val = atomics::detail::integral_extend< Signed, storage_type >(static_cast< emulated_storage_type >(old_val ^ v));
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_val, new_val, order, memory_order_relaxed));
         return new_val;
     }
 
@@ -392,6 +548,149 @@ struct extra_operations_generic< Base, Size, Signed, true > :
         storage_type old_val = base_type::fetch_xor(storage, mask, order);
         return !!(old_val & mask);
     }
+
+    static BOOST_FORCEINLINE storage_type fetch_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not less than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        atomics::detail::cas_backoff backoff;
+        while (atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v) &&
+            !base_type::compare_exchange_weak(storage, old_val, v, order, load_order))
+        {
+            backoff();
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not greater than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        atomics::detail::cas_backoff backoff;
+        while (atomics::detail::integral_less< emulated_storage_type, Signed >(v, old_val) &&
+            !base_type::compare_exchange_weak(storage, old_val, v, order, load_order))
+        {
+            backoff();
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE void opaque_max(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_max(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE void opaque_min(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        fetch_min(storage, v, order);
+    }
+
+    static BOOST_FORCEINLINE bool max_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_max(storage, v, order);
+        return !!static_cast< emulated_storage_type >(atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v) ? v : old_val);
+    }
+
+    static BOOST_FORCEINLINE bool min_and_test(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        const storage_type old_val = fetch_min(storage, v, order);
+        return !!static_cast< emulated_storage_type >(atomics::detail::integral_less< emulated_storage_type, Signed >(v, old_val) ? v : old_val);
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if the result saturates to its current value, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            new_val = atomics::detail::integral_add_sat< emulated_storage_type, Signed >(old_val, v);
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_add_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not less than limit, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (!atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, limit))
+                break;
+            new_val = atomics::detail::integral_add_sat< emulated_storage_type, Signed >(old_val, v);
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(limit, new_val))
+                new_val = limit;
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if the result saturates to its current value, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            new_val = atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v);
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE storage_type fetch_sub_sat(storage_type volatile& storage, storage_type v, storage_type limit, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is not greater than limit, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        storage_type new_val;
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (!atomics::detail::integral_less< emulated_storage_type, Signed >(limit, old_val))
+                break;
+            new_val = atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v);
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(new_val, limit))
+                new_val = limit;
+            if (new_val == old_val)
+                break;
+            if (base_type::compare_exchange_weak(storage, old_val, new_val, order, load_order))
+                break;
+        }
+        return old_val;
+    }
+
+    static BOOST_FORCEINLINE bool sub_if_ge(storage_type volatile& storage, storage_type v, memory_order order) noexcept
+    {
+        // The atomic object is not modified if its value is less than v, in which case the operation is only a load
+        const memory_order load_order = atomics::detail::deduce_failure_order(order);
+        storage_type old_val = base_type::load(storage, load_order);
+        for (atomics::detail::cas_backoff backoff;; backoff())
+        {
+            if (atomics::detail::integral_less< emulated_storage_type, Signed >(old_val, v))
+                return false;
+            // For signed types, v may be negative, in which case the result is clamped at the max value
+            if (base_type::compare_exchange_weak(
+                storage, old_val, atomics::detail::integral_sub_sat< emulated_storage_type, Signed >(old_val, v), order, load_order))
+                break;
+        }
+        return true;
+    }
 };
 
 // Default extra_operations template definition will be used unless specialized for a specific platform
@@ -0,0 +1,97 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/fetch_update.hpp
+ *
+ * This header contains implementation of the generic read-modify-write operations.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
+
+#include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/memory_order_utils.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+/*!
+ * \brief Replaces the value of the atomic object with the result of \a fn applied to the current value
+ *
+ * The function object is called with the current value of the atomic object and must return the new value.
+ * The function object may be called multiple times, if the atomic object is concurrently modified. Returns the value
+ * the function object was last called with, which is the value the atomic object had before the modification.
+ */
+template< typename Atomic, typename Value, typename Function >
+BOOST_FORCEINLINE Value fetch_update(Atomic& a, Function& fn, memory_order order)
+{
+    const memory_order load_order = atomics::detail::deduce_failure_order(order);
+    Value old_val = a.load(load_order);
+    Value new_val = fn(static_cast< Value const& >(old_val));
+    if (BOOST_UNLIKELY(!a.compare_exchange_weak(old_val, new_val, order, load_order)))
+    {
+        atomics::detail::cas_backoff backoff;
+        do
+        {
+            backoff();
+            new_val = fn(static_cast< Value const& >(old_val));
+        }
+        while (!a.compare_exchange_weak(old_val, new_val, order, load_order));
+    }
+
+    return old_val;
+}
+
+/*!
+ * \brief Conditionally modifies the value of the atomic object by \a fn
+ *
+ * The function object is called with a copy of the current value of the atomic object, which it may modify. If the function
+ * object returns \c true, the modified value is stored in the atomic object, otherwise the operation completes without
+ * modifying the atomic object. The function object may be called multiple times, if the atomic object is concurrently modified.
+ * Returns \c true if the atomic object was modified.
+ */
+template< typename Atomic, typename Value, typename Function >
+BOOST_FORCEINLINE bool update_if(Atomic& a, Function& fn, memory_order order)
+{
+    const memory_order load_order = atomics::detail::deduce_failure_order(order);
+    Value old_val = a.load(load_order);
+    Value new_val = old_val;
+    if (!fn(new_val))
+        return false;
+
+    if (BOOST_UNLIKELY(!a.compare_exchange_weak(old_val, new_val, order, load_order)))
+    {
+        atomics::detail::cas_backoff backoff;
+        do
+        {
+            backoff();
+            new_val = old_val;
+            if (!fn(new_val))
+                return false;
+        }
+        while (!a.compare_exchange_weak(old_val, new_val, order, load_order));
+    }
+
+    return true;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_FETCH_UPDATE_HPP_INCLUDED_
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <boost/memory_order.hpp>
+#include <boost/atomic/cas_backoff.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/bitwise_fp_cast.hpp>
 #include <boost/atomic/detail/storage_traits.hpp>
@@ -44,13 +45,14 @@ struct fp_operations_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = old_val + v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return old_val;
     }
 
@@ -59,13 +61,14 @@ struct fp_operations_generic :
         storage_type old_storage, new_storage;
         value_type old_val, new_val;
         atomics::detail::non_atomic_load(storage, old_storage);
-        do
+        for (atomics::detail::cas_backoff backoff;; backoff())
         {
             old_val = atomics::detail::bitwise_fp_cast< value_type >(old_storage);
             new_val = old_val - v;
             new_storage = atomics::detail::bitwise_fp_cast< storage_type >(new_val);
+            if (base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed))
+                break;
         }
-        while (!base_type::compare_exchange_weak(storage, old_storage, new_storage, order, memory_order_relaxed));
         return old_val;
     }
 };
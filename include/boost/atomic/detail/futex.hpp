@@ -102,6 +102,60 @@
 #define BOOST_ATOMIC_DETAIL_FUTEX_CLOCK_REALTIME 256
 #endif
 
+#if defined(__linux__)
+
+// futex_waitv syscall was added in Linux 5.16. It allows to block on multiple futexes.
+#if defined(SYS_futex_waitv)
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV SYS_futex_waitv
+#elif defined(__NR_futex_waitv)
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV __NR_futex_waitv
+#endif
+
+// futex_wake and futex_wait syscalls were added in Linux 6.7.
+// Unlike SYS_futex, these syscalls support futexes of different sizes.
+#if defined(SYS_futex_wake) && defined(SYS_futex_wait)
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAKE SYS_futex_wake
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAIT SYS_futex_wait
+#elif defined(BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV)
+// Older kernel headers don't define the syscall numbers. On all architectures, the syscalls follow futex_waitv with the same offsets.
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAKE (BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV + 5)
+#define BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAIT (BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV + 6)
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV)
+#define BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV
+//! Max number of futexes in a single futex_waitv call
+#define BOOST_ATOMIC_DETAIL_FUTEX_WAITV_MAX 128
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAKE)
+#define BOOST_ATOMIC_DETAIL_HAS_FUTEX2
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV) || defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+#if defined(FUTEX2_SIZE_U8)
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U8 FUTEX2_SIZE_U8
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U16 FUTEX2_SIZE_U16
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U32 FUTEX2_SIZE_U32
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U64 FUTEX2_SIZE_U64
+#else
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U8 0x00
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U16 0x01
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U32 0x02
+#define BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U64 0x03
+#endif
+
+#if defined(FUTEX2_PRIVATE)
+#define BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE FUTEX2_PRIVATE
+#else
+#define BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE 128
+#endif
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV) || defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+#endif // defined(__linux__)
+
 namespace boost {
 namespace atomics {
 namespace detail {
@@ -235,6 +289,122 @@ BOOST_FORCEINLINE int futex_requeue
     return futex_invoke(pval1, FUTEX_REQUEUE | flags, wake_count, requeue_count, pval2);
 }
 
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV) || defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+//! An equivalent of `__kernel_timespec` that is used by futex2 syscalls
+struct futex2_timespec
+{
+    std::int64_t tv_sec;
+    std::int64_t tv_nsec;
+};
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV) || defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV)
+
+//! An equivalent of `struct futex_waitv` that describes one of the futexes to wait on in futex_waitv
+struct futex_waitv_entry
+{
+    //! Expected value of the futex
+    std::uint64_t val;
+    //! Futex address
+    std::uint64_t uaddr;
+    //! Futex size and private flags
+    std::uint32_t flags;
+    //! Reserved, must be zero
+    std::uint32_t reserved;
+};
+
+//! Checks that the values of all futexes are equal to the expected values and blocks until any of the futexes is woken up. Returns the index of the woken futex.
+BOOST_FORCEINLINE int futex_waitv(futex_waitv_entry* waiters, unsigned int count, const futex2_timespec* timeout = nullptr, clockid_t clock_id = CLOCK_MONOTONIC) noexcept
+{
+    return ::syscall(BOOST_ATOMIC_DETAIL_SYS_FUTEX_WAITV, waiters, count, 0u, timeout, clock_id);
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV)
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+//! Returns the bit mask that matches any waiter of a futex2 with the given flags
+BOOST_FORCEINLINE unsigned long futex2_bitset_match_any(unsigned int flags) noexcept
+{
+    // The kernel requires the bit mask to not exceed the futex size
+    const unsigned int size_bits = 8u << (flags & 3u);
+    return size_bits < sizeof(unsigned long) * 8u ? ((1ul << size_bits) - 1ul) : ~0ul;
+}
+
+//! Checks that the value \c pval is \c expected and blocks, optionally until the absolute timeout on the clock \c clock_id
+BOOST_FORCEINLINE int futex2_wait
+(
+    void* pval,
+    std::uint64_t expected,
+    unsigned int flags,
+    const futex2_timespec* timeout = nullptr,
+    clockid_t clock_id = CLOCK_MONOTONIC
+) noexcept
+{
+    return ::syscall
+    (
+        BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAIT,
+        pval,
+        static_cast< unsigned long >(expected),
+        futex2_bitset_match_any(flags),
+        flags,
+        timeout,
+        clock_id
+    );
+}
+
+//! Wakes the specified number of threads waiting on the futex2
+BOOST_FORCEINLINE int futex2_wake(void* pval, unsigned int flags, int count = 1) noexcept
+{
+    return ::syscall(BOOST_ATOMIC_DETAIL_SYS_FUTEX2_WAKE, pval, futex2_bitset_match_any(flags), count, flags);
+}
+
+//! Detects futex sizes supported by futex2 syscalls in the running kernel. The bit \c (1u << BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_Un) is set if n-bit futexes are supported.
+BOOST_NOINLINE inline unsigned int detect_futex2_supported_sizes() noexcept
+{
+    alignas(8) std::uint64_t dummy = 0u;
+    unsigned int sizes = 0u;
+    const unsigned int size_flags[] =
+    {
+        BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U8,
+        BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U16,
+        BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U32,
+        BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U64
+    };
+    for (unsigned int size_flag : size_flags)
+    {
+        // The syscall fails with ENOSYS on kernels older than 6.7 and with EINVAL if the kernel does not support the futex size.
+        // Note that Linux 6.7 only supports 32-bit futexes in futex2 syscalls.
+        if (atomics::detail::futex2_wake(&dummy, size_flag | BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE, 0) >= 0)
+            sizes |= 1u << size_flag;
+    }
+
+    return sizes;
+}
+
+//! Returns a bit mask of futex sizes supported by futex2 syscalls. The sizes are detected on the first call.
+BOOST_FORCEINLINE unsigned int get_futex2_supported_sizes() noexcept
+{
+    //! The bit is set in the cached sizes when the detection is complete
+    constexpr unsigned int sizes_detected = 1u << 31u;
+
+    // The variable is constant-initialized, so accessing it does not involve a guard variable. The detection result
+    // is the same in all threads, so it doesn't matter if multiple threads perform it concurrently.
+    static unsigned int sizes = 0u;
+    unsigned int s = __atomic_load_n(&sizes, __ATOMIC_RELAXED);
+    if (BOOST_UNLIKELY(s == 0u))
+    {
+        s = atomics::detail::detect_futex2_supported_sizes() | sizes_detected;
+        __atomic_store_n(&sizes, s, __ATOMIC_RELAXED);
+    }
+
+    return s & ~sizes_detected;
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
 } // namespace detail
 } // namespace atomics
 } // namespace boost
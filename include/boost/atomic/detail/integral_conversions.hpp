@@ -99,6 +99,73 @@ BOOST_FORCEINLINE Output integral_extend(Input input) noexcept
     return atomics::detail::integral_extend< Output >(input, std::integral_constant< bool, Signed >());
 }
 
+//! Returns \c true if \a x is less than \a y, when both operands are truncated to \c Unsigned type or its signed counterpart, if \c Signed is \c true
+template< typename Unsigned, bool Signed, typename Input >
+BOOST_FORCEINLINE bool integral_less(Input x, Input y) noexcept
+{
+    using value_type = typename std::conditional< Signed, typename atomics::detail::make_signed< Unsigned >::type, Unsigned >::type;
+    return atomics::detail::integral_truncate< value_type >(x) < atomics::detail::integral_truncate< value_type >(y);
+}
+
+template< typename Unsigned, typename Input >
+BOOST_FORCEINLINE Input integral_add_sat_impl(Input x, Input y, std::false_type) noexcept
+{
+    const Unsigned a = atomics::detail::integral_truncate< Unsigned >(x);
+    Unsigned r = static_cast< Unsigned >(a + atomics::detail::integral_truncate< Unsigned >(y));
+    if (r < a)
+        r = static_cast< Unsigned >(~static_cast< Unsigned >(0u));
+    return atomics::detail::zero_extend< Input >(r);
+}
+
+template< typename Unsigned, typename Input >
+BOOST_FORCEINLINE Input integral_add_sat_impl(Input x, Input y, std::true_type) noexcept
+{
+    constexpr Unsigned sign_bit = static_cast< Unsigned >(~(static_cast< Unsigned >(~static_cast< Unsigned >(0u)) >> 1u));
+    const Unsigned a = atomics::detail::integral_truncate< Unsigned >(x);
+    const Unsigned b = atomics::detail::integral_truncate< Unsigned >(y);
+    Unsigned r = static_cast< Unsigned >(a + b);
+    // Overflow happened if both operands have the same sign, which is different from the sign of the result
+    if ((static_cast< Unsigned >((r ^ a) & (r ^ b)) & sign_bit) != 0u)
+        r = (a & sign_bit) != 0u ? sign_bit : static_cast< Unsigned >(~sign_bit);
+    return atomics::detail::sign_extend< Input >(r);
+}
+
+//! Adds \a y to \a x, saturating at the bounds of \c Unsigned type or its signed counterpart, if \c Signed is \c true. The result is extended to \c Input type.
+template< typename Unsigned, bool Signed, typename Input >
+BOOST_FORCEINLINE Input integral_add_sat(Input x, Input y) noexcept
+{
+    return atomics::detail::integral_add_sat_impl< Unsigned >(x, y, std::integral_constant< bool, Signed >());
+}
+
+template< typename Unsigned, typename Input >
+BOOST_FORCEINLINE Input integral_sub_sat_impl(Input x, Input y, std::false_type) noexcept
+{
+    const Unsigned a = atomics::detail::integral_truncate< Unsigned >(x);
+    const Unsigned b = atomics::detail::integral_truncate< Unsigned >(y);
+    const Unsigned r = a >= b ? static_cast< Unsigned >(a - b) : static_cast< Unsigned >(0u);
+    return atomics::detail::zero_extend< Input >(r);
+}
+
+template< typename Unsigned, typename Input >
+BOOST_FORCEINLINE Input integral_sub_sat_impl(Input x, Input y, std::true_type) noexcept
+{
+    constexpr Unsigned sign_bit = static_cast< Unsigned >(~(static_cast< Unsigned >(~static_cast< Unsigned >(0u)) >> 1u));
+    const Unsigned a = atomics::detail::integral_truncate< Unsigned >(x);
+    const Unsigned b = atomics::detail::integral_truncate< Unsigned >(y);
+    Unsigned r = static_cast< Unsigned >(a - b);
+    // Overflow happened if the operands have different signs and the sign of the result is different from the minuend
+    if ((static_cast< Unsigned >((a ^ b) & (a ^ r)) & sign_bit) != 0u)
+        r = (a & sign_bit) != 0u ? sign_bit : static_cast< Unsigned >(~sign_bit);
+    return atomics::detail::sign_extend< Input >(r);
+}
+
+//! Subtracts \a y from \a x, saturating at the bounds of \c Unsigned type or its signed counterpart, if \c Signed is \c true. The result is extended to \c Input type.
+template< typename Unsigned, bool Signed, typename Input >
+BOOST_FORCEINLINE Input integral_sub_sat(Input x, Input y) noexcept
+{
+    return atomics::detail::integral_sub_sat_impl< Unsigned >(x, y, std::integral_constant< bool, Signed >());
+}
+
 } // namespace detail
 } // namespace atomics
 } // namespace boost
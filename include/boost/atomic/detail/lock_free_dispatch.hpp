@@ -0,0 +1,74 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/lock_free_dispatch.hpp
+ *
+ * This header contains utilities for core operations that select lock-free or lock-based implementation at run time.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_LOCK_FREE_DISPATCH_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_LOCK_FREE_DISPATCH_HPP_INCLUDED_
+
+#include <type_traits>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+/*!
+ * \brief The trait indicates whether the core operations select lock-free or lock-based implementation at run time
+ *
+ * Such core operations have \c is_always_lock_free set to \c true, so that the operations implemented on top of them
+ * (extra, floating point and waiting operations) don't use the lock pool directly. The core operations provide a static
+ * \c is_lock_free member function that returns \c true if the lock-free implementation is selected.
+ */
+template< typename Operations, typename = void >
+struct has_lock_free_dispatch : public std::false_type {};
+
+template< typename Operations >
+struct has_lock_free_dispatch< Operations, decltype(static_cast< void >(Operations::is_lock_free())) > : public std::true_type {};
+
+//! The trait indicates whether the core operations are lock-free regardless of the CPU the code runs on
+template< typename Operations >
+struct is_always_lock_free :
+    public std::integral_constant< bool, Operations::is_always_lock_free && !has_lock_free_dispatch< Operations >::value >
+{
+};
+
+template< typename Operations >
+BOOST_FORCEINLINE bool is_lock_free_impl(std::true_type) noexcept
+{
+    return Operations::is_lock_free();
+}
+
+template< typename Operations >
+BOOST_FORCEINLINE constexpr bool is_lock_free_impl(std::false_type) noexcept
+{
+    return Operations::is_always_lock_free;
+}
+
+//! Returns \c true if the core operations are lock-free on the current CPU
+template< typename Operations >
+BOOST_FORCEINLINE bool is_lock_free() noexcept
+{
+    return atomics::detail::is_lock_free_impl< Operations >(has_lock_free_dispatch< Operations >());
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_LOCK_FREE_DISPATCH_HPP_INCLUDED_
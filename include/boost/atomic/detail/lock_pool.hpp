@@ -16,10 +16,13 @@
 #define BOOST_ATOMIC_DETAIL_LOCK_POOL_HPP_INCLUDED_
 
 #include <cstddef>
+#include <cstdint>
 #include <chrono>
+#include <boost/memory_order.hpp>
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/link.hpp>
 #include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/futex.hpp>
 #if defined(BOOST_WINDOWS)
 #include <boost/winapi/thread.hpp>
 #else // defined(BOOST_WINDOWS)
@@ -58,9 +61,13 @@ BOOST_FORCEINLINE void wait_some() noexcept
 namespace lock_pool {
 
 BOOST_ATOMIC_DECL void* short_lock(atomics::detail::uintptr_t h) noexcept;
+BOOST_ATOMIC_DECL void short_unlock(void* vls) noexcept;
 BOOST_ATOMIC_DECL void* long_lock(atomics::detail::uintptr_t h) noexcept;
 BOOST_ATOMIC_DECL void unlock(void* vls) noexcept;
 
+//! Loads the atomic object value without locking, unless there is a concurrent modification
+BOOST_ATOMIC_DECL void load(atomics::detail::uintptr_t h, const volatile void* addr, void* value, std::size_t size, memory_order order) noexcept;
+
 BOOST_ATOMIC_DECL void* allocate_wait_state(void* vls, const volatile void* addr) noexcept;
 BOOST_ATOMIC_DECL void free_wait_state(void* vls, void* vws) noexcept;
 BOOST_ATOMIC_DECL void wait(void* vls, void* vws) noexcept;
@@ -68,8 +75,70 @@ BOOST_ATOMIC_DECL void wait(void* vls, void* vws) noexcept;
 BOOST_ATOMIC_DECL bool wait_until(void* vls, void* vws, clockid_t clock_id, timespec const& abs_timeout) noexcept;
 #endif // !defined(BOOST_WINDOWS)
 BOOST_ATOMIC_DECL bool wait_for(void* vls, void* vws, std::chrono::nanoseconds rel_timeout) noexcept;
-BOOST_ATOMIC_DECL void notify_one(void* vls, const volatile void* addr) noexcept;
-BOOST_ATOMIC_DECL void notify_all(void* vls, const volatile void* addr) noexcept;
+BOOST_ATOMIC_DECL void notify_one(atomics::detail::uintptr_t h, const volatile void* addr) noexcept;
+BOOST_ATOMIC_DECL void notify_all(atomics::detail::uintptr_t h, const volatile void* addr) noexcept;
+
+//! Atomic object description for wait_any operation
+struct wait_any_entry
+{
+    //! Pointer hash value of the atomic object
+    atomics::detail::uintptr_t hash;
+    //! Address of the atomic object
+    const volatile void* addr;
+};
+
+/*!
+ * \brief Blocks until any of the atomic objects is notified and changes its value
+ *
+ * The \a find_changed function is called with \a context to test the atomic objects and must return the index of the object
+ * whose value has changed, or \a count if none of the objects changed. The returned index is also returned from \c wait_any.
+ */
+BOOST_ATOMIC_DECL std::size_t wait_any(wait_any_entry const* entries, std::size_t count, std::size_t (*find_changed)(void* context), void* context) noexcept;
+
+#if !defined(BOOST_WINDOWS)
+
+//! Returns the entry of the attached IPC wait table that is associated with the atomic object, or \c nullptr if no IPC wait table is attached or the object is outside the table memory region
+BOOST_ATOMIC_DECL void* get_ipc_wait_entry(const volatile void* addr) noexcept;
+//! Registers a waiting operation in the IPC wait table entry. Returns the wake sequence number to pass to \c ipc_wait.
+BOOST_ATOMIC_DECL std::uint32_t register_ipc_waiter(void* entry) noexcept;
+//! Unregisters a waiting operation
+BOOST_ATOMIC_DECL void unregister_ipc_waiter(void* entry) noexcept;
+//! Blocks until notified, unless the wake sequence number is different from \a seq. Returns the current wake sequence number.
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait(void* entry, std::uint32_t seq) noexcept;
+//! Blocks until notified or timeout, unless the wake sequence number is different from \a seq. Returns the current wake sequence number.
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait_for(void* entry, std::uint32_t seq, std::chrono::nanoseconds rel_timeout) noexcept;
+//! Wakes up all waiting operations blocked on the IPC wait table entry associated with the atomic object
+BOOST_ATOMIC_DECL void ipc_notify(const volatile void* addr) noexcept;
+
+#endif // !defined(BOOST_WINDOWS)
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
+
+//! Proxy futex that is used to implement waiting and notifying operations for atomic objects of sizes not supported by futexes
+struct futex_proxy
+{
+    //! Futex word. Incremented by notifying operations when there are blocked waiting operations.
+    std::uint32_t m_futex;
+    //! Number of waiting operations that may block on the futex word
+    std::uint32_t m_waiter_count;
+    //! Spin lock that protects the registration of the waiting operations
+    std::uint32_t m_lock;
+    //! Indicates that the waiting operations are blocked on different atomic objects
+    std::uint32_t m_mixed_addresses;
+    //! Address of the atomic object the waiting operations are blocked on, if m_mixed_addresses is zero
+    const volatile void* m_address;
+};
+
+//! Returns the proxy futex associated with the given pointer hash value
+BOOST_ATOMIC_DECL futex_proxy* get_futex_proxy(atomics::detail::uintptr_t h) noexcept;
+//! Registers a waiting operation on the atomic object at the given address. Returns the value of the futex word.
+BOOST_ATOMIC_DECL std::uint32_t register_futex_proxy_waiter(futex_proxy* proxy, const volatile void* addr) noexcept;
+//! Unregisters a waiting operation
+BOOST_ATOMIC_DECL void unregister_futex_proxy_waiter(futex_proxy* proxy) noexcept;
+//! Wakes up a waiting operation blocked on the atomic object at the given address
+BOOST_ATOMIC_DECL void notify_one_futex_proxy(futex_proxy* proxy, const volatile void* addr) noexcept;
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
 
 BOOST_ATOMIC_DECL void thread_fence() noexcept;
 BOOST_ATOMIC_DECL void signal_fence() noexcept;
@@ -112,7 +181,10 @@ public:
 
     ~scoped_lock() noexcept
     {
-        lock_pool::unlock(m_lock);
+        BOOST_IF_CONSTEXPR (!LongLock)
+            lock_pool::short_unlock(m_lock);
+        else
+            lock_pool::unlock(m_lock);
     }
 
     void* get_lock_state() const noexcept
@@ -161,6 +233,43 @@ public:
     }
 };
 
+#if !defined(BOOST_WINDOWS)
+
+//! Registers a waiting operation in the IPC wait table entry for the duration of its lifetime
+class scoped_ipc_waiter
+{
+private:
+    void* m_entry;
+    std::uint32_t m_sequence;
+
+public:
+    explicit scoped_ipc_waiter(void* entry) noexcept :
+        m_entry(entry),
+        m_sequence(lock_pool::register_ipc_waiter(entry))
+    {
+    }
+
+    scoped_ipc_waiter(scoped_ipc_waiter const&) = delete;
+    scoped_ipc_waiter& operator=(scoped_ipc_waiter const&) = delete;
+
+    ~scoped_ipc_waiter() noexcept
+    {
+        lock_pool::unregister_ipc_waiter(m_entry);
+    }
+
+    void wait() noexcept
+    {
+        m_sequence = lock_pool::ipc_wait(m_entry, m_sequence);
+    }
+
+    void wait_for(std::chrono::nanoseconds rel_timeout) noexcept
+    {
+        m_sequence = lock_pool::ipc_wait_for(m_entry, m_sequence, rel_timeout);
+    }
+};
+
+#endif // !defined(BOOST_WINDOWS)
+
 } // namespace lock_pool
 } // namespace detail
 } // namespace atomics
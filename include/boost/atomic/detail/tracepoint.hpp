@@ -0,0 +1,50 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/tracepoint.hpp
+ *
+ * This header defines macros for static tracepoints in waiting and notifying operations and the lock pool.
+ *
+ * When \c BOOST_ATOMIC_TRACEPOINTS is defined, the tracepoints are implemented with \c sys/sdt.h from SystemTap and can be
+ * attached to by \c perf, \c bpftrace and other tools as \c usdt probes of the \c boost_atomic provider. Otherwise the macros
+ * expand to nothing. The first argument of every tracepoint is an address, which is passed as an integer.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_TRACEPOINT_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT_HPP_INCLUDED_
+
+#include <boost/atomic/detail/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(BOOST_ATOMIC_TRACEPOINTS)
+
+#include <sys/sdt.h>
+#include <boost/atomic/detail/intptr.hpp>
+
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT_ADDRESS(addr)\
+    reinterpret_cast< boost::atomics::detail::uintptr_t >(static_cast< const volatile void* >(addr))
+
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT1(name, addr)\
+    DTRACE_PROBE1(boost_atomic, name, BOOST_ATOMIC_DETAIL_TRACEPOINT_ADDRESS(addr))
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT2(name, addr, arg2)\
+    DTRACE_PROBE2(boost_atomic, name, BOOST_ATOMIC_DETAIL_TRACEPOINT_ADDRESS(addr), arg2)
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT3(name, addr, arg2, arg3)\
+    DTRACE_PROBE3(boost_atomic, name, BOOST_ATOMIC_DETAIL_TRACEPOINT_ADDRESS(addr), arg2, arg3)
+
+#else // defined(BOOST_ATOMIC_TRACEPOINTS)
+
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT1(name, addr)
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT2(name, addr, arg2)
+#define BOOST_ATOMIC_DETAIL_TRACEPOINT3(name, addr, arg2, arg3)
+
+#endif // defined(BOOST_ATOMIC_TRACEPOINTS)
+
+#endif // BOOST_ATOMIC_DETAIL_TRACEPOINT_HPP_INCLUDED_
@@ -0,0 +1,42 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/wait_any_fwd.hpp
+ *
+ * This header contains forward declaration of the \c wait_any_impl template.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_WAIT_ANY_FWD_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_WAIT_ANY_FWD_HPP_INCLUDED_
+
+#include <type_traits>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+template< typename Atomic >
+struct wait_any_impl;
+
+//! The trait indicates whether the atomic type can be used with \c wait_any
+template< typename Atomic >
+struct is_wait_any_supported : public std::true_type {};
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_WAIT_ANY_FWD_HPP_INCLUDED_
@@ -0,0 +1,349 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/wait_any_impl.hpp
+ *
+ * This header contains implementation of the \c wait_any operation.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_WAIT_ANY_IMPL_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_WAIT_ANY_IMPL_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <new>
+#include <type_traits>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/thread_pause.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include <boost/atomic/detail/futex.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/bitwise_cast.hpp>
+#include <boost/atomic/detail/atomic_impl.hpp>
+#include <boost/atomic/detail/atomic_ref_impl.hpp>
+#include <boost/atomic/detail/wait_any_fwd.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX_WAITV) && !defined(BOOST_ATOMIC_DETAIL_WAIT_BACKEND_GENERIC)
+// futex_waitv can only be used if native waiting and notifying operations are implemented with futexes
+#define BOOST_ATOMIC_DETAIL_WAIT_ANY_USE_FUTEX_WAITV
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+// The functions are only used to deduce the common base class of the atomic types
+template< typename T, bool Signed, bool Interprocess >
+base_atomic_common< T, Signed, Interprocess > const* get_wait_any_base(base_atomic_common< T, Signed, Interprocess > const volatile*) noexcept;
+template< typename T, bool Signed, bool Interprocess >
+base_atomic_ref_common< T, Signed, Interprocess > const* get_wait_any_base(base_atomic_ref_common< T, Signed, Interprocess > const volatile*) noexcept;
+
+//! The trait indicates whether the waiting and notifying operations block on proxy futexes, when the atomic objects cannot be used as futexes
+template< typename WaitOperations, typename = void >
+struct is_futex_proxy_based : public std::false_type {};
+
+template< typename WaitOperations >
+struct is_futex_proxy_based< WaitOperations, typename std::enable_if< WaitOperations::uses_futex_proxy >::type > : public std::true_type {};
+
+template< typename Atomic >
+struct wait_any_impl
+{
+    using atomic_type = Atomic;
+    using base_type = typename std::remove_const< typename std::remove_pointer<
+        decltype(atomics::detail::get_wait_any_base(static_cast< atomic_type const* >(nullptr)))
+    >::type >::type;
+    using value_type = typename base_type::value_type;
+    using core_operations = typename base_type::core_operations;
+    using wait_operations = typename base_type::wait_operations;
+    using storage_type = typename core_operations::storage_type;
+
+    static_assert(atomics::detail::is_wait_any_supported< atomic_type >::value, "boost::atomics::wait_any does not support the specified atomic type");
+
+private:
+    //! Tag for the implementation that blocks on all atomic objects with a single futex_waitv syscall
+    struct futex_waitv_tag {};
+    //! Tag for the implementation that registers the waiting operation in the lock pool for every atomic object
+    struct lock_pool_tag {};
+    //! Tag for the implementation that polls the atomic objects
+    struct polling_tag {};
+
+    //! Indicates that the atomic objects can be used as futexes in futex_waitv, if the kernel supports futexes of their size
+    static constexpr bool use_futex_waitv_objects =
+#if defined(BOOST_ATOMIC_DETAIL_WAIT_ANY_USE_FUTEX_WAITV)
+        core_operations::is_always_lock_free && sizeof(value_type) == sizeof(storage_type) &&
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+        (sizeof(storage_type) == 1u || sizeof(storage_type) == 2u || sizeof(storage_type) == 4u || sizeof(storage_type) == 8u);
+#else
+        sizeof(storage_type) == 4u;
+#endif
+#else
+        false;
+#endif
+    //! Indicates that the waiting operations block on proxy futexes, which can be used in futex_waitv instead of the atomic objects
+    static constexpr bool use_futex_waitv_proxies =
+#if defined(BOOST_ATOMIC_DETAIL_WAIT_ANY_USE_FUTEX_WAITV)
+        core_operations::is_always_lock_free && !core_operations::is_interprocess && atomics::detail::is_futex_proxy_based< wait_operations >::value;
+#else
+        false;
+#endif
+    static constexpr bool use_futex_waitv = use_futex_waitv_objects || use_futex_waitv_proxies;
+    // Waiting operations of atomics with non-native waiting and notifying operations are implemented with the lock pool
+    static constexpr bool use_lock_pool = !core_operations::is_interprocess && !wait_operations::always_has_native_wait_notify;
+
+    using implementation_tag = typename std::conditional<
+        use_futex_waitv,
+        futex_waitv_tag,
+        typename std::conditional< use_lock_pool, lock_pool_tag, polling_tag >::type
+    >::type;
+
+    //! Number of polling iterations before the thread starts sleeping between iterations
+    static constexpr unsigned int fast_loop_count = 16u;
+    //! Max number of atomic objects for which the temporary descriptors are allocated on the stack
+    static constexpr std::size_t max_local_entries = 16u;
+
+    //! Arguments of the wait_any operation
+    struct arguments
+    {
+        atomic_type const* const* objects;
+        value_type const* old_values;
+        std::size_t count;
+        memory_order order;
+    };
+
+public:
+    static BOOST_FORCEINLINE std::size_t wait_any(atomic_type const* const* objects, value_type const* old_values, std::size_t count, memory_order order) noexcept
+    {
+        arguments args = { objects, old_values, count, order };
+        return wait_any_impl::wait_any(args, implementation_tag());
+    }
+
+private:
+    static BOOST_FORCEINLINE storage_type const volatile* get_storage(atomic_type const* object) noexcept
+    {
+        return &static_cast< base_type const* >(object)->storage();
+    }
+
+    //! Returns the index of the first atomic object whose value is different from the old value or \c count if all values are the same
+    static std::size_t find_changed(arguments const& args) noexcept
+    {
+        for (std::size_t i = 0u; i < args.count; ++i)
+        {
+            if (atomics::detail::bitwise_cast< storage_type >(args.objects[i]->load(args.order)) != atomics::detail::bitwise_cast< storage_type >(args.old_values[i]))
+                return i;
+        }
+
+        return args.count;
+    }
+
+    static std::size_t find_changed_callback(void* context) noexcept
+    {
+        return wait_any_impl::find_changed(*static_cast< arguments const* >(context));
+    }
+
+    static std::size_t wait_any(arguments const& args, polling_tag) noexcept
+    {
+        std::size_t index = wait_any_impl::find_changed(args);
+        if (index == args.count)
+        {
+            for (unsigned int i = 0u; i < fast_loop_count; ++i)
+            {
+                atomics::thread_pause();
+                index = wait_any_impl::find_changed(args);
+                if (index < args.count)
+                    goto finish;
+            }
+
+            do
+            {
+                atomics::detail::wait_some();
+                index = wait_any_impl::find_changed(args);
+            }
+            while (index == args.count);
+        }
+
+    finish:
+        return index;
+    }
+
+    static std::size_t wait_any(arguments const& args, lock_pool_tag) noexcept
+    {
+        std::size_t index = wait_any_impl::find_changed(args);
+        if (index < args.count)
+            return index;
+
+        lock_pool::wait_any_entry local_entries[max_local_entries] = {};
+        lock_pool::wait_any_entry* entries = local_entries;
+        if (args.count > max_local_entries)
+        {
+            entries = new (std::nothrow) lock_pool::wait_any_entry[args.count];
+            if (BOOST_UNLIKELY(entries == nullptr))
+                return wait_any_impl::wait_any(args, polling_tag());
+        }
+
+        for (std::size_t i = 0u; i < args.count; ++i)
+        {
+            storage_type const volatile* storage = wait_any_impl::get_storage(args.objects[i]);
+            entries[i].hash = lock_pool::hash_ptr< core_operations::storage_alignment >(storage);
+            entries[i].addr = storage;
+        }
+
+        index = lock_pool::wait_any(entries, args.count, &wait_any_impl::find_changed_callback, const_cast< arguments* >(&args));
+
+        if (entries != local_entries)
+            delete[] entries;
+
+        return index;
+    }
+
+#if defined(BOOST_ATOMIC_DETAIL_WAIT_ANY_USE_FUTEX_WAITV)
+
+    static constexpr unsigned int futex_size_flag =
+        sizeof(storage_type) == 1u ? BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U8 :
+        sizeof(storage_type) == 2u ? BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U16 :
+        sizeof(storage_type) == 4u ? BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U32 : BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U64;
+    static constexpr unsigned int futex_flags = futex_size_flag | (core_operations::is_interprocess ? 0u : BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE);
+
+    //! Returns \c true if the waiting and notifying operations block on the atomic objects as futexes
+    static BOOST_FORCEINLINE bool has_futex_waitv() noexcept
+    {
+        BOOST_IF_CONSTEXPR (!use_futex_waitv_objects)
+            return false;
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+        // Waiting operations on atomics other than 32-bit block on futexes only if the kernel supports futexes of the corresponding size
+        BOOST_IF_CONSTEXPR (sizeof(storage_type) != 4u)
+            return (atomics::detail::get_futex2_supported_sizes() & (1u << futex_size_flag)) != 0u;
+#endif
+        return true;
+    }
+
+    static std::size_t wait_any(arguments const& args, futex_waitv_tag) noexcept
+    {
+        std::size_t index = wait_any_impl::find_changed(args);
+        if (index < args.count)
+            return index;
+
+        const bool use_objects = wait_any_impl::has_futex_waitv();
+        if (BOOST_UNLIKELY(args.count > BOOST_ATOMIC_DETAIL_FUTEX_WAITV_MAX || (!use_objects && !use_futex_waitv_proxies)))
+            return wait_any_impl::wait_any(args, polling_tag());
+
+        futex_waitv_entry local_entries[max_local_entries];
+        futex_waitv_entry* entries = local_entries;
+        if (args.count > max_local_entries)
+        {
+            entries = new (std::nothrow) futex_waitv_entry[args.count];
+            if (BOOST_UNLIKELY(entries == nullptr))
+                return wait_any_impl::wait_any(args, polling_tag());
+        }
+
+        if (use_objects)
+            index = wait_any_impl::wait_any_futex_objects(args, entries);
+        else
+            index = wait_any_impl::wait_any_futex_proxies(args, entries);
+
+        if (entries != local_entries)
+            delete[] entries;
+
+        return index;
+    }
+
+    //! Blocks on the atomic objects as futexes
+    static std::size_t wait_any_futex_objects(arguments const& args, futex_waitv_entry* entries) noexcept
+    {
+        for (std::size_t i = 0u; i < args.count; ++i)
+        {
+            entries[i].val = static_cast< std::uint64_t >(atomics::detail::bitwise_cast< storage_type >(args.old_values[i]));
+            entries[i].uaddr = static_cast< std::uint64_t >(reinterpret_cast< atomics::detail::uintptr_t >(wait_any_impl::get_storage(args.objects[i])));
+            entries[i].flags = futex_flags;
+            entries[i].reserved = 0u;
+        }
+
+        std::size_t index;
+        while (true)
+        {
+            // The syscall returns when any of the futexes is woken up or if any of the atomic values differs from the expected one
+            const int res = atomics::detail::futex_waitv(entries, static_cast< unsigned int >(args.count));
+            index = wait_any_impl::find_changed(args);
+            if (index < args.count)
+                break;
+
+            if (BOOST_UNLIKELY(res < 0 && errno != EINTR && errno != EAGAIN))
+            {
+                // futex_waitv is not supported by the kernel
+                index = wait_any_impl::wait_any(args, polling_tag());
+                break;
+            }
+        }
+
+        return index;
+    }
+
+    //! Blocks on the proxy futexes associated with the atomic objects, which are used by the waiting and notifying operations on these objects
+    static std::size_t wait_any_futex_proxies(arguments const& args, futex_waitv_entry* entries) noexcept
+    {
+        using futex_operations = atomics::detail::core_operations< 4u, false, false >;
+
+        for (std::size_t i = 0u; i < args.count; ++i)
+        {
+            storage_type const volatile* storage = wait_any_impl::get_storage(args.objects[i]);
+            lock_pool::futex_proxy* const proxy = wait_any_impl::get_futex_proxy(storage);
+            entries[i].val = lock_pool::register_futex_proxy_waiter(proxy, storage);
+            entries[i].uaddr = static_cast< std::uint64_t >(reinterpret_cast< atomics::detail::uintptr_t >(&proxy->m_futex));
+            entries[i].flags = BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U32 | BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE;
+            entries[i].reserved = 0u;
+        }
+
+        std::size_t index;
+        while (true)
+        {
+            index = wait_any_impl::find_changed(args);
+            if (index < args.count)
+                break;
+
+            // The syscall returns when any of the proxy futexes is woken up or if any of the futex values differs from the expected one
+            const int res = atomics::detail::futex_waitv(entries, static_cast< unsigned int >(args.count));
+            if (BOOST_UNLIKELY(res < 0 && errno != EINTR && errno != EAGAIN))
+                break; // futex_waitv is not supported by the kernel
+
+            for (std::size_t i = 0u; i < args.count; ++i)
+            {
+                std::uint32_t* const futex = reinterpret_cast< std::uint32_t* >(static_cast< atomics::detail::uintptr_t >(entries[i].uaddr));
+                entries[i].val = futex_operations::load(*futex, memory_order_acquire);
+            }
+        }
+
+        for (std::size_t i = 0u; i < args.count; ++i)
+            lock_pool::unregister_futex_proxy_waiter(wait_any_impl::get_futex_proxy(wait_any_impl::get_storage(args.objects[i])));
+
+        if (BOOST_UNLIKELY(index == args.count))
+            index = wait_any_impl::wait_any(args, polling_tag());
+
+        return index;
+    }
+
+    static BOOST_FORCEINLINE lock_pool::futex_proxy* get_futex_proxy(storage_type const volatile* storage) noexcept
+    {
+        return lock_pool::get_futex_proxy(lock_pool::hash_ptr< core_operations::storage_alignment >(storage));
+    }
+
+#endif // defined(BOOST_ATOMIC_DETAIL_WAIT_ANY_USE_FUTEX_WAITV)
+};
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_WAIT_ANY_IMPL_HPP_INCLUDED_
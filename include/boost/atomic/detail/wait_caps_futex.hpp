@@ -26,6 +26,30 @@
 // futexes are always 32-bit and they always supported address-free operations
 #define BOOST_ATOMIC_HAS_NATIVE_INT32_WAIT_NOTIFY BOOST_ATOMIC_INT32_LOCK_FREE
 #define BOOST_ATOMIC_HAS_NATIVE_INT32_IPC_WAIT_NOTIFY BOOST_ATOMIC_INT32_LOCK_FREE
+
+#if BOOST_ATOMIC_INT32_LOCK_FREE == 2
+// Other sizes are supported by blocking on proxy futexes, which are process-local
+#define BOOST_ATOMIC_HAS_NATIVE_INT8_WAIT_NOTIFY BOOST_ATOMIC_INT8_LOCK_FREE
+#define BOOST_ATOMIC_HAS_NATIVE_INT16_WAIT_NOTIFY BOOST_ATOMIC_INT16_LOCK_FREE
+#define BOOST_ATOMIC_HAS_NATIVE_INT64_WAIT_NOTIFY BOOST_ATOMIC_INT64_LOCK_FREE
+#if BOOST_ATOMIC_INT128_LOCK_FREE > 0
+// Proxy futexes are used regardless of whether 128-bit atomic operations are lock-free on the target CPU
+#define BOOST_ATOMIC_HAS_NATIVE_INT128_WAIT_NOTIFY 2
+#endif
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+// Inter-process waiting and notifying operations are native if the running kernel supports futex2 syscalls for the given size
+#if BOOST_ATOMIC_INT8_LOCK_FREE == 2
+#define BOOST_ATOMIC_HAS_NATIVE_INT8_IPC_WAIT_NOTIFY 1
+#endif
+#if BOOST_ATOMIC_INT16_LOCK_FREE == 2
+#define BOOST_ATOMIC_HAS_NATIVE_INT16_IPC_WAIT_NOTIFY 1
+#endif
+#if BOOST_ATOMIC_INT64_LOCK_FREE == 2
+#define BOOST_ATOMIC_HAS_NATIVE_INT64_IPC_WAIT_NOTIFY 1
+#endif
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+#endif // BOOST_ATOMIC_INT32_LOCK_FREE == 2
 #endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
 
 #endif // BOOST_ATOMIC_DETAIL_WAIT_CAPS_FUTEX_HPP_INCLUDED_
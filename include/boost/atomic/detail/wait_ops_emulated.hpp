@@ -44,7 +44,6 @@ struct wait_operations_emulated :
 {
     using base_type = Base;
     using storage_type = typename base_type::storage_type;
-    using scoped_lock = lock_pool::scoped_lock< base_type::storage_alignment, true >;
     using scoped_wait_state = lock_pool::scoped_wait_state< base_type::storage_alignment >;
 
     static constexpr bool always_has_native_wait_notify = false;
@@ -54,16 +53,16 @@ struct wait_operations_emulated :
         return false;
     }
 
-    static storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order) noexcept
+    static storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order order) noexcept
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        storage_type const& s = const_cast< storage_type const& >(storage);
+        // Note: Modifying operations do not lock the wait state mutex, so the value must be loaded with a proper atomic load
         scoped_wait_state wait_state(&storage);
-        storage_type new_val = s;
+        storage_type new_val = base_type::load(storage, order);
         while (new_val == old_val)
         {
             wait_state.wait();
-            new_val = s;
+            new_val = base_type::load(storage, order);
         }
 
         return new_val;
@@ -77,12 +76,12 @@ private:
         storage_type old_val,
         typename Clock::time_point timeout,
         typename Clock::time_point now,
+        memory_order order,
         bool& timed_out
     ) noexcept(noexcept(Clock::now()))
     {
-        storage_type const& s = const_cast< storage_type const& >(storage);
         scoped_wait_state wait_state(&storage);
-        storage_type new_val = s;
+        storage_type new_val = base_type::load(storage, order);
         while (new_val == old_val)
         {
             const std::chrono::nanoseconds nsec = atomics::detail::chrono::ceil< std::chrono::nanoseconds >(timeout - now);
@@ -95,7 +94,7 @@ private:
             wait_state.wait_for(nsec);
 
             now = Clock::now();
-            new_val = s;
+            new_val = base_type::load(storage, order);
         }
 
         return new_val;
@@ -109,19 +108,19 @@ private:
         storage_type const volatile& storage,
         storage_type old_val,
         typename Clock::time_point timeout,
+        memory_order order,
         bool& timed_out
     ) noexcept
     {
-        storage_type const& s = const_cast< storage_type const& >(storage);
         scoped_wait_state wait_state(&storage);
-        storage_type new_val = s;
+        storage_type new_val = base_type::load(storage, order);
         const timespec abs_timeout(posix_clock_traits< Clock >::to_timespec(timeout));
         if (BOOST_LIKELY(abs_timeout.tv_sec >= 0))
         {
             while (new_val == old_val)
             {
                 const bool wait_timed_out = wait_state.wait_until(posix_clock_traits< Clock >::clock_id, abs_timeout);
-                new_val = s;
+                new_val = base_type::load(storage, order);
 
                 if (wait_timed_out)
                     goto timeout_expired;
@@ -142,11 +141,12 @@ private:
         storage_type const volatile& storage,
         storage_type old_val,
         typename Clock::time_point timeout,
+        memory_order order,
         bool& timed_out,
         std::true_type
     ) noexcept
     {
-        return wait_until_abs_timeout< Clock >(storage, old_val, timeout,timed_out);
+        return wait_until_abs_timeout< Clock >(storage, old_val, timeout, order, timed_out);
     }
 
     template< typename Clock >
@@ -155,11 +155,12 @@ private:
         storage_type const volatile& storage,
         storage_type old_val,
         typename Clock::time_point timeout,
+        memory_order order,
         bool& timed_out,
         std::false_type
     ) noexcept(noexcept(Clock::now()))
     {
-        return wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), timed_out);
+        return wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), order, timed_out);
     }
 
 public:
@@ -169,12 +170,12 @@ public:
         storage_type const volatile& storage,
         storage_type old_val,
         std::chrono::time_point< Clock, Duration > timeout,
-        memory_order,
+        memory_order order,
         bool& timed_out
-    ) noexcept(noexcept(wait_until_dispatch< Clock >(storage, old_val, timeout, timed_out, std::integral_constant< bool, has_posix_clock_traits< Clock >::value >())))
+    ) noexcept(noexcept(wait_until_dispatch< Clock >(storage, old_val, timeout, order, timed_out, std::integral_constant< bool, has_posix_clock_traits< Clock >::value >())))
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        return wait_until_dispatch< Clock >(storage, old_val, timeout, timed_out, std::integral_constant< bool, has_posix_clock_traits< Clock >::value >());
+        return wait_until_dispatch< Clock >(storage, old_val, timeout, order, timed_out, std::integral_constant< bool, has_posix_clock_traits< Clock >::value >());
     }
 
 #else // !defined(BOOST_WINDOWS)
@@ -186,12 +187,12 @@ public:
         storage_type const volatile& storage,
         storage_type old_val,
         std::chrono::time_point< Clock, Duration > timeout,
-        memory_order,
+        memory_order order,
         bool& timed_out
-    ) noexcept(noexcept(wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), timed_out)))
+    ) noexcept(noexcept(wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), order, timed_out)))
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        return wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), timed_out);
+        return wait_until_fallback< Clock >(storage, old_val, timeout, Clock::now(), order, timed_out);
     }
 
 #endif // !defined(BOOST_WINDOWS)
@@ -202,27 +203,25 @@ public:
         storage_type const volatile& storage,
         storage_type old_val,
         std::chrono::duration< Rep, Period > timeout,
-        memory_order,
+        memory_order order,
         bool& timed_out
     ) noexcept
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
         const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
-        return wait_until_fallback< std::chrono::steady_clock >(storage, old_val, now + timeout, now, timed_out);
+        return wait_until_fallback< std::chrono::steady_clock >(storage, old_val, now + timeout, now, order, timed_out);
     }
 
     static void notify_one(storage_type volatile& storage) noexcept
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        scoped_lock lock(&storage);
-        lock_pool::notify_one(lock.get_lock_state(), &storage);
+        lock_pool::notify_one(lock_pool::hash_ptr< base_type::storage_alignment >(&storage), &storage);
     }
 
     static void notify_all(storage_type volatile& storage) noexcept
     {
         static_assert(!base_type::is_interprocess, "Boost.Atomic: operation invoked on a non-lock-free inter-process atomic object");
-        scoped_lock lock(&storage);
-        lock_pool::notify_all(lock.get_lock_state(), &storage);
+        lock_pool::notify_all(lock_pool::hash_ptr< base_type::storage_alignment >(&storage), &storage);
     }
 };
 
@@ -26,8 +26,13 @@
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/chrono.hpp>
 #include <boost/atomic/detail/futex.hpp>
+#include <boost/atomic/detail/lock_pool.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
 #include <boost/atomic/detail/has_posix_clock_traits.hpp>
+#include <boost/atomic/detail/tracepoint.hpp>
 #include <boost/atomic/detail/wait_operations_fwd.hpp>
+#include <boost/atomic/detail/wait_ops_generic.hpp>
 #include <boost/atomic/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -117,7 +122,9 @@ public:
         storage_type new_val = base_type::load(storage, order);
         while (new_val == old_val)
         {
+            BOOST_ATOMIC_DETAIL_TRACEPOINT2(futex_wait_start, &storage, old_val);
             atomics::detail::futex_wait(const_cast< storage_type* >(&storage), old_val, futex_private_flag);
+            BOOST_ATOMIC_DETAIL_TRACEPOINT1(futex_wait_done, &storage);
             new_val = base_type::load(storage, order);
         }
 
@@ -336,15 +343,365 @@ public:
 
     static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) noexcept
     {
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(futex_notify_one, &storage);
         atomics::detail::futex_signal(const_cast< storage_type* >(&storage), futex_private_flag);
     }
 
     static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) noexcept
     {
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(futex_notify_all, &storage);
         atomics::detail::futex_broadcast(const_cast< storage_type* >(&storage), futex_private_flag);
     }
 };
 
+//! Implementation of waiting/notifying operations for atomic objects of sizes not supported by futexes. Blocks on a proxy futex from a process-wide table.
+template< typename Base >
+struct wait_operations_futex_proxy :
+    public Base
+{
+    using base_type = Base;
+    using storage_type = typename base_type::storage_type;
+
+    static constexpr bool always_has_native_wait_notify = true;
+    //! Indicates that the operations block on proxy futexes
+    static constexpr bool uses_futex_proxy = true;
+
+private:
+    using futex_operations = core_operations< 4u, false, false >;
+    static_assert(sizeof(futex_operations::storage_type) == sizeof(std::uint32_t), "Boost.Atomic: unsupported futex storage type");
+
+public:
+    static BOOST_FORCEINLINE bool has_native_wait_notify(storage_type const volatile&) noexcept
+    {
+        return true;
+    }
+
+    static BOOST_FORCEINLINE storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order order) noexcept
+    {
+        storage_type new_val = base_type::load(storage, order);
+        if (new_val == old_val)
+        {
+            lock_pool::futex_proxy* const proxy = get_proxy(storage);
+            std::uint32_t futex_val = lock_pool::register_futex_proxy_waiter(proxy, &storage);
+            while (true)
+            {
+                new_val = base_type::load(storage, order);
+                if (new_val != old_val)
+                    break;
+
+                atomics::detail::futex_wait(&proxy->m_futex, futex_val, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+                futex_val = futex_operations::load(proxy->m_futex, memory_order_acquire);
+            }
+            lock_pool::unregister_futex_proxy_waiter(proxy);
+        }
+
+        return new_val;
+    }
+
+private:
+    template< typename Clock >
+    static BOOST_FORCEINLINE storage_type wait_until_impl
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        typename Clock::time_point timeout,
+        typename Clock::time_point now,
+        memory_order order,
+        bool& timed_out
+    ) noexcept(noexcept(Clock::now()))
+    {
+        storage_type new_val = base_type::load(storage, order);
+        if (new_val == old_val)
+        {
+            lock_pool::futex_proxy* const proxy = get_proxy(storage);
+            std::uint32_t futex_val = lock_pool::register_futex_proxy_waiter(proxy, &storage);
+            futex_timespec ts{};
+            while (true)
+            {
+                new_val = base_type::load(storage, order);
+                if (new_val != old_val)
+                    break;
+
+                const std::int64_t nsec = atomics::detail::chrono::ceil< std::chrono::nanoseconds >(timeout - now).count();
+                if (nsec <= 0)
+                {
+                    timed_out = true;
+                    break;
+                }
+
+                const std::int64_t sec = nsec / 1000000000;
+                if (BOOST_LIKELY(sec <= (std::numeric_limits< decltype(ts.tv_sec) >::max)()))
+                {
+                    ts.tv_sec = static_cast< decltype(ts.tv_sec) >(sec);
+                    ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(nsec % 1000000000);
+                }
+                else
+                {
+                    ts.tv_sec = (std::numeric_limits< decltype(ts.tv_sec) >::max)();
+                    ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(999999999);
+                }
+
+                atomics::detail::futex_wait_for(&proxy->m_futex, futex_val, ts, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+
+                now = Clock::now();
+                futex_val = futex_operations::load(proxy->m_futex, memory_order_acquire);
+            }
+            lock_pool::unregister_futex_proxy_waiter(proxy);
+        }
+
+        return new_val;
+    }
+
+public:
+    template< typename Clock, typename Duration >
+    static BOOST_FORCEINLINE storage_type wait_until
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        std::chrono::time_point< Clock, Duration > timeout,
+        memory_order order,
+        bool& timed_out
+    ) noexcept(noexcept(Clock::now()))
+    {
+        return wait_until_impl< Clock >(storage, old_val, timeout, Clock::now(), order, timed_out);
+    }
+
+    template< typename Rep, typename Period >
+    static BOOST_FORCEINLINE storage_type wait_for
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        std::chrono::duration< Rep, Period > timeout,
+        memory_order order,
+        bool& timed_out
+    ) noexcept
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        return wait_until_impl< std::chrono::steady_clock >(storage, old_val, now + timeout, now, order, timed_out);
+    }
+
+    static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) noexcept
+    {
+        lock_pool::futex_proxy* const proxy = get_proxy(storage);
+        // Pairs with the fence in register_futex_proxy_waiter. Either we see the registered waiter
+        // or the waiter sees the modified value of the atomic object.
+        fence_operations::thread_fence(memory_order_seq_cst);
+        if (futex_operations::load(proxy->m_waiter_count, memory_order_relaxed) > 0u)
+            lock_pool::notify_one_futex_proxy(proxy, &storage);
+    }
+
+    static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) noexcept
+    {
+        lock_pool::futex_proxy* const proxy = get_proxy(storage);
+        fence_operations::thread_fence(memory_order_seq_cst);
+        if (futex_operations::load(proxy->m_waiter_count, memory_order_relaxed) > 0u)
+        {
+            futex_operations::fetch_add(proxy->m_futex, 1u, memory_order_release);
+            atomics::detail::futex_broadcast(&proxy->m_futex, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+        }
+    }
+
+private:
+    static BOOST_FORCEINLINE lock_pool::futex_proxy* get_proxy(storage_type const volatile& storage) noexcept
+    {
+        return lock_pool::get_futex_proxy(lock_pool::hash_ptr< base_type::storage_alignment >(&storage));
+    }
+};
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+/*!
+ * \brief Implementation of waiting/notifying operations based on futex2 syscalls, which support futexes of different sizes.
+ *
+ * Whether the running kernel supports futex2 syscalls for the given size is detected at run time. If it doesn't,
+ * the operations are implemented by the fallback implementation, which is based on proxy futexes for process-local
+ * atomic objects and the generic implementation for inter-process atomic objects.
+ */
+template< typename Base, unsigned int SizeFlag, bool Interprocess >
+struct wait_operations_futex2 :
+    public std::conditional< Interprocess, wait_operations_generic< Base, true >, wait_operations_futex_proxy< Base > >::type
+{
+    using base_type = Base;
+    using storage_type = typename base_type::storage_type;
+    using fallback_type = typename std::conditional< Interprocess, wait_operations_generic< Base, true >, wait_operations_futex_proxy< Base > >::type;
+
+    static constexpr bool always_has_native_wait_notify = fallback_type::always_has_native_wait_notify;
+
+private:
+    static constexpr unsigned int futex2_flags = SizeFlag | (Interprocess ? 0u : BOOST_ATOMIC_DETAIL_FUTEX2_PRIVATE);
+
+    static BOOST_FORCEINLINE bool has_futex2() noexcept
+    {
+        return (atomics::detail::get_futex2_supported_sizes() & (1u << SizeFlag)) != 0u;
+    }
+
+public:
+    static BOOST_FORCEINLINE bool has_native_wait_notify(storage_type const volatile& storage) noexcept
+    {
+        return has_futex2() || fallback_type::has_native_wait_notify(storage);
+    }
+
+    static BOOST_FORCEINLINE storage_type wait(storage_type const volatile& storage, storage_type old_val, memory_order order) noexcept
+    {
+        if (BOOST_UNLIKELY(!has_futex2()))
+            return fallback_type::wait(storage, old_val, order);
+
+        storage_type new_val = base_type::load(storage, order);
+        while (new_val == old_val)
+        {
+            atomics::detail::futex2_wait(const_cast< storage_type* >(&storage), old_val, futex2_flags);
+            new_val = base_type::load(storage, order);
+        }
+
+        return new_val;
+    }
+
+private:
+    template< typename Clock >
+    static BOOST_FORCEINLINE storage_type wait_until_impl
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        typename Clock::time_point timeout,
+        typename Clock::time_point now,
+        memory_order order,
+        bool& timed_out
+    ) noexcept(noexcept(Clock::now()))
+    {
+        storage_type new_val = base_type::load(storage, order);
+        while (new_val == old_val)
+        {
+            const std::int64_t nsec = atomics::detail::chrono::ceil< std::chrono::nanoseconds >(timeout - now).count();
+            if (nsec <= 0)
+            {
+                timed_out = true;
+                break;
+            }
+
+            // futex2 syscalls only accept absolute timeouts
+            timespec mono_now{};
+            if (BOOST_UNLIKELY(clock_gettime(CLOCK_MONOTONIC, &mono_now) != 0))
+            {
+                atomics::detail::futex2_wait(const_cast< storage_type* >(&storage), old_val, futex2_flags);
+            }
+            else
+            {
+                futex2_timespec ts{};
+                ts.tv_sec = static_cast< std::int64_t >(mono_now.tv_sec) + nsec / 1000000000;
+                ts.tv_nsec = static_cast< std::int64_t >(mono_now.tv_nsec) + nsec % 1000000000;
+                if (ts.tv_nsec >= 1000000000)
+                {
+                    ++ts.tv_sec;
+                    ts.tv_nsec -= 1000000000;
+                }
+
+                atomics::detail::futex2_wait(const_cast< storage_type* >(&storage), old_val, futex2_flags, &ts, CLOCK_MONOTONIC);
+            }
+
+            now = Clock::now();
+            new_val = base_type::load(storage, order);
+        }
+
+        return new_val;
+    }
+
+public:
+    template< typename Clock, typename Duration >
+    static BOOST_FORCEINLINE storage_type wait_until
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        std::chrono::time_point< Clock, Duration > timeout,
+        memory_order order,
+        bool& timed_out
+    ) noexcept(noexcept(fallback_type::wait_until(storage, old_val, timeout, order, timed_out)) && noexcept(Clock::now()))
+    {
+        if (BOOST_UNLIKELY(!has_futex2()))
+            return fallback_type::wait_until(storage, old_val, timeout, order, timed_out);
+
+        return wait_until_impl< Clock >(storage, old_val, timeout, Clock::now(), order, timed_out);
+    }
+
+    template< typename Rep, typename Period >
+    static BOOST_FORCEINLINE storage_type wait_for
+    (
+        storage_type const volatile& storage,
+        storage_type old_val,
+        std::chrono::duration< Rep, Period > timeout,
+        memory_order order,
+        bool& timed_out
+    ) noexcept
+    {
+        if (BOOST_UNLIKELY(!has_futex2()))
+            return fallback_type::wait_for(storage, old_val, timeout, order, timed_out);
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        return wait_until_impl< std::chrono::steady_clock >(storage, old_val, now + timeout, now, order, timed_out);
+    }
+
+    static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) noexcept
+    {
+        if (BOOST_LIKELY(has_futex2()))
+            atomics::detail::futex2_wake(const_cast< storage_type* >(&storage), futex2_flags, 1);
+        else
+            fallback_type::notify_one(storage);
+    }
+
+    static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) noexcept
+    {
+        if (BOOST_LIKELY(has_futex2()))
+            atomics::detail::futex2_wake(const_cast< storage_type* >(&storage), futex2_flags, (std::numeric_limits< int >::max)());
+        else
+            fallback_type::notify_all(storage);
+    }
+};
+
+template< typename Base, bool Interprocess >
+struct wait_operations< Base, 1u, true, Interprocess > :
+    public wait_operations_futex2< Base, BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U8, Interprocess >
+{
+};
+
+template< typename Base, bool Interprocess >
+struct wait_operations< Base, 2u, true, Interprocess > :
+    public wait_operations_futex2< Base, BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U16, Interprocess >
+{
+};
+
+template< typename Base, bool Interprocess >
+struct wait_operations< Base, 8u, true, Interprocess > :
+    public wait_operations_futex2< Base, BOOST_ATOMIC_DETAIL_FUTEX2_SIZE_U64, Interprocess >
+{
+};
+
+#else // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+template< typename Base >
+struct wait_operations< Base, 1u, true, false > :
+    public wait_operations_futex_proxy< Base >
+{
+};
+
+template< typename Base >
+struct wait_operations< Base, 2u, true, false > :
+    public wait_operations_futex_proxy< Base >
+{
+};
+
+template< typename Base >
+struct wait_operations< Base, 8u, true, false > :
+    public wait_operations_futex_proxy< Base >
+{
+};
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX2)
+
+template< typename Base >
+struct wait_operations< Base, 16u, true, false > :
+    public wait_operations_futex_proxy< Base >
+{
+};
+
 } // namespace detail
 } // namespace atomics
 } // namespace boost
@@ -50,7 +50,6 @@ struct wait_operations_generic< Base, false > :
 {
     using base_type = Base;
     using storage_type = typename base_type::storage_type;
-    using scoped_lock = lock_pool::scoped_lock< base_type::storage_alignment, true >;
     using scoped_wait_state = lock_pool::scoped_wait_state< base_type::storage_alignment >;
 
     static constexpr bool always_has_native_wait_notify = false;
@@ -227,14 +226,12 @@ public:
 
     static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) noexcept
     {
-        scoped_lock lock(&storage);
-        lock_pool::notify_one(lock.get_lock_state(), &storage);
+        lock_pool::notify_one(lock_pool::hash_ptr< base_type::storage_alignment >(&storage), &storage);
     }
 
     static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) noexcept
     {
-        scoped_lock lock(&storage);
-        lock_pool::notify_all(lock.get_lock_state(), &storage);
+        lock_pool::notify_all(lock_pool::hash_ptr< base_type::storage_alignment >(&storage), &storage);
     }
 };
 
@@ -269,6 +266,22 @@ public:
                     goto finish;
             }
 
+#if !defined(BOOST_WINDOWS)
+            void* entry = lock_pool::get_ipc_wait_entry(&storage);
+            if (entry != nullptr)
+            {
+                lock_pool::scoped_ipc_waiter waiter(entry);
+                new_val = base_type::load(storage, order);
+                while (new_val == old_val)
+                {
+                    waiter.wait();
+                    new_val = base_type::load(storage, order);
+                }
+
+                goto finish;
+            }
+#endif // !defined(BOOST_WINDOWS)
+
             do
             {
                 atomics::detail::wait_some();
@@ -312,6 +325,31 @@ private:
                     goto finish;
             }
 
+#if !defined(BOOST_WINDOWS)
+            void* entry = lock_pool::get_ipc_wait_entry(&storage);
+            if (entry != nullptr)
+            {
+                lock_pool::scoped_ipc_waiter waiter(entry);
+                new_val = base_type::load(storage, order);
+                while (new_val == old_val)
+                {
+                    const std::chrono::nanoseconds nsec = atomics::detail::chrono::ceil< std::chrono::nanoseconds >(timeout - now);
+                    if (nsec.count() <= 0)
+                    {
+                        timed_out = true;
+                        break;
+                    }
+
+                    waiter.wait_for(nsec);
+
+                    now = Clock::now();
+                    new_val = base_type::load(storage, order);
+                }
+
+                goto finish;
+            }
+#endif // !defined(BOOST_WINDOWS)
+
             do
             {
                 if ((now - timeout).count() >= 0)
@@ -359,6 +397,20 @@ public:
         return wait_until_impl< std::chrono::steady_clock >(storage, old_val, now + timeout, now, order, timed_out);
     }
 
+#if !defined(BOOST_WINDOWS)
+
+    static BOOST_FORCEINLINE void notify_one(storage_type volatile& storage) noexcept
+    {
+        lock_pool::ipc_notify(&storage);
+    }
+
+    static BOOST_FORCEINLINE void notify_all(storage_type volatile& storage) noexcept
+    {
+        lock_pool::ipc_notify(&storage);
+    }
+
+#else // !defined(BOOST_WINDOWS)
+
     static BOOST_FORCEINLINE void notify_one(storage_type volatile&) noexcept
     {
     }
@@ -366,6 +418,8 @@ public:
     static BOOST_FORCEINLINE void notify_all(storage_type volatile&) noexcept
     {
     }
+
+#endif // !defined(BOOST_WINDOWS)
 };
 
 template< typename Base, std::size_t Size, bool Interprocess >
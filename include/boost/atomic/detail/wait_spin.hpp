@@ -0,0 +1,199 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/wait_spin.hpp
+ *
+ * This header contains implementation of the spinning phase of waiting operations.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_WAIT_SPIN_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_WAIT_SPIN_HPP_INCLUDED_
+
+#include <chrono>
+#include <utility>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/thread_pause.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! Number of spin iterations between checking the clock, when the spinning phase is limited by time
+constexpr unsigned int wait_spin_clock_check_interval = 8u;
+
+//! Spins until the atomic value differs from \a old_val or the spinning limits are reached. Returns the last loaded value.
+template< typename WaitOperations >
+BOOST_NOINLINE typename WaitOperations::storage_type wait_spin
+(
+    typename WaitOperations::storage_type const volatile& storage,
+    typename WaitOperations::storage_type old_val,
+    memory_order order,
+    wait_spin_policy const& policy
+) noexcept
+{
+    typename WaitOperations::storage_type new_val = WaitOperations::load(storage, order);
+    if (new_val == old_val)
+    {
+        if (policy.max_duration.count() <= 0)
+        {
+            for (unsigned int i = 0u; i < policy.max_iterations; ++i)
+            {
+                atomics::thread_pause();
+                new_val = WaitOperations::load(storage, order);
+                if (new_val != old_val)
+                    break;
+            }
+        }
+        else
+        {
+            const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + policy.max_duration;
+            for (unsigned int i = 0u; i < policy.max_iterations; ++i)
+            {
+                atomics::thread_pause();
+                new_val = WaitOperations::load(storage, order);
+                if (new_val != old_val)
+                    break;
+
+                if ((i % wait_spin_clock_check_interval) == (wait_spin_clock_check_interval - 1u) && std::chrono::steady_clock::now() >= deadline)
+                    break;
+            }
+        }
+    }
+
+    return new_val;
+}
+
+//! Spins until the atomic value differs from \a old_val, the spinning limits are reached or \a timeout expires. Returns the last loaded value.
+template< typename WaitOperations, typename Clock, typename Duration >
+BOOST_NOINLINE typename WaitOperations::storage_type wait_spin_until
+(
+    typename WaitOperations::storage_type const volatile& storage,
+    typename WaitOperations::storage_type old_val,
+    std::chrono::time_point< Clock, Duration > timeout,
+    memory_order order,
+    wait_spin_policy const& policy
+) noexcept(noexcept(Clock::now()))
+{
+    typename WaitOperations::storage_type new_val = WaitOperations::load(storage, order);
+    if (new_val == old_val && policy.max_iterations > 0u && Clock::now() < timeout)
+    {
+        const bool limited_by_duration = policy.max_duration.count() > 0;
+        std::chrono::steady_clock::time_point deadline;
+        if (limited_by_duration)
+            deadline = std::chrono::steady_clock::now() + policy.max_duration;
+
+        for (unsigned int i = 0u; i < policy.max_iterations; ++i)
+        {
+            atomics::thread_pause();
+            new_val = WaitOperations::load(storage, order);
+            if (new_val != old_val)
+                break;
+
+            if ((i % wait_spin_clock_check_interval) == (wait_spin_clock_check_interval - 1u))
+            {
+                if (Clock::now() >= timeout || (limited_by_duration && std::chrono::steady_clock::now() >= deadline))
+                    break;
+            }
+        }
+    }
+
+    return new_val;
+}
+
+//! Converts a relative timeout to a steady clock deadline
+template< typename Rep, typename Period >
+BOOST_FORCEINLINE std::chrono::steady_clock::time_point make_wait_deadline(std::chrono::duration< Rep, Period > timeout) noexcept
+{
+    return std::chrono::steady_clock::now() + std::chrono::duration_cast< std::chrono::steady_clock::duration >(timeout);
+}
+
+//! Performs a waiting operation with a spinning phase before blocking
+template< typename WaitOperations >
+BOOST_FORCEINLINE typename WaitOperations::storage_type wait_with_spin
+(
+    typename WaitOperations::storage_type const volatile& storage,
+    typename WaitOperations::storage_type old_val,
+    memory_order order,
+    wait_spin_policy const& policy
+) noexcept
+{
+    if (policy.max_iterations == 0u)
+        return WaitOperations::wait(storage, old_val, order);
+
+    typename WaitOperations::storage_type new_val = atomics::detail::wait_spin< WaitOperations >(storage, old_val, order, policy);
+    if (new_val == old_val)
+        new_val = WaitOperations::wait(storage, old_val, order);
+
+    return new_val;
+}
+
+//! Performs a waiting operation with a timeout, with a spinning phase before blocking. The spinning phase ends no later than the timeout expires.
+template< typename WaitOperations, typename Clock, typename Duration >
+BOOST_FORCEINLINE typename WaitOperations::storage_type wait_until_with_spin
+(
+    typename WaitOperations::storage_type const volatile& storage,
+    typename WaitOperations::storage_type old_val,
+    std::chrono::time_point< Clock, Duration > timeout,
+    memory_order order,
+    wait_spin_policy const& policy,
+    bool& timed_out
+) noexcept(noexcept(WaitOperations::wait_until(
+    std::declval< typename WaitOperations::storage_type const volatile& >(), std::declval< typename WaitOperations::storage_type >(), timeout, order, std::declval< bool& >())))
+{
+    if (policy.max_iterations == 0u)
+        return WaitOperations::wait_until(storage, old_val, timeout, order, timed_out);
+
+    typename WaitOperations::storage_type new_val = atomics::detail::wait_spin_until< WaitOperations >(storage, old_val, timeout, order, policy);
+    if (new_val == old_val)
+        new_val = WaitOperations::wait_until(storage, old_val, timeout, order, timed_out);
+
+    return new_val;
+}
+
+//! Performs a waiting operation with a timeout, with a spinning phase before blocking. The timeout includes the spinning phase.
+template< typename WaitOperations, typename Rep, typename Period >
+BOOST_FORCEINLINE typename WaitOperations::storage_type wait_for_with_spin
+(
+    typename WaitOperations::storage_type const volatile& storage,
+    typename WaitOperations::storage_type old_val,
+    std::chrono::duration< Rep, Period > timeout,
+    memory_order order,
+    wait_spin_policy const& policy,
+    bool& timed_out
+) noexcept(noexcept(WaitOperations::wait_for(
+    std::declval< typename WaitOperations::storage_type const volatile& >(), std::declval< typename WaitOperations::storage_type >(), timeout, order, std::declval< bool& >())) &&
+    noexcept(WaitOperations::wait_until(
+    std::declval< typename WaitOperations::storage_type const volatile& >(), std::declval< typename WaitOperations::storage_type >(),
+    std::declval< std::chrono::steady_clock::time_point >(), order, std::declval< bool& >())))
+{
+    if (policy.max_iterations == 0u)
+        return WaitOperations::wait_for(storage, old_val, timeout, order, timed_out);
+
+    // Convert the timeout to a deadline before spinning, so that the time spent spinning is not added to the timeout
+    const std::chrono::steady_clock::time_point deadline = atomics::detail::make_wait_deadline(timeout);
+    typename WaitOperations::storage_type new_val = atomics::detail::wait_spin_until< WaitOperations >(storage, old_val, deadline, order, policy);
+    if (new_val == old_val)
+        new_val = WaitOperations::wait_until(storage, old_val, deadline, order, timed_out);
+
+    return new_val;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_WAIT_SPIN_HPP_INCLUDED_
@@ -0,0 +1,95 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/detail/x86_cpu_features.hpp
+ *
+ * This header contains run time detection of x86 CPU features that are used by atomic operations.
+ */
+
+#ifndef BOOST_ATOMIC_DETAIL_X86_CPU_FEATURES_HPP_INCLUDED_
+#define BOOST_ATOMIC_DETAIL_X86_CPU_FEATURES_HPP_INCLUDED_
+
+#include <cpuid.h>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+namespace x86_cpu_features {
+
+//! The CPU supports cmpxchg16b instruction
+constexpr unsigned int cmpxchg16b = 1u;
+//! The CPU is an Intel or AMD CPU that supports AVX. Such CPUs guarantee that aligned 16-byte vector loads and stores are atomic.
+constexpr unsigned int avx = 1u << 1u;
+//! The bit is set in the cached features when the detection is complete
+constexpr unsigned int detected = 1u << 31u;
+
+} // namespace x86_cpu_features
+
+//! Detects x86 CPU features. Returns a bit mask of \c x86_cpu_features constants.
+BOOST_NOINLINE inline unsigned int detect_x86_cpu_features() noexcept
+{
+    unsigned int features = 0u;
+
+    // Obtain CPU vendor. The atomicity of vector loads and stores is only documented by Intel and AMD.
+    unsigned int eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+    bool is_intel_or_amd = false;
+    if (__get_cpuid(0u, &eax, &ebx, &ecx, &edx))
+    {
+        // "GenuineIntel" or "AuthenticAMD", stored in ebx, edx, ecx
+        is_intel_or_amd = (ebx == 0x756e6547u && edx == 0x49656e69u && ecx == 0x6c65746eu) ||
+            (ebx == 0x68747541u && edx == 0x69746e65u && ecx == 0x444d4163u);
+    }
+
+    // Obtain CPU features, if cpuid function 1 is supported
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx))
+    {
+#if defined(__x86_64__)
+        // cmpxchg16b is only usable in 64-bit mode
+        if ((ecx & (1u << 13)) != 0u)
+            features |= x86_cpu_features::cmpxchg16b;
+#endif
+
+        // Atomicity of the vector loads and stores only depends on the CPU, the OS support for saving AVX state
+        // is not required to use legacy SSE instructions. Other vendors don't guarantee the atomicity, even with AVX.
+        if (is_intel_or_amd && (ecx & (1u << 28)) != 0u)
+            features |= x86_cpu_features::avx;
+    }
+
+    return features;
+}
+
+//! Returns the x86 CPU features. The features are detected on the first call.
+BOOST_FORCEINLINE unsigned int get_x86_cpu_features() noexcept
+{
+    // The variable is constant-initialized, so accessing it does not involve a guard variable. The detection result
+    // is the same in all threads, so it doesn't matter if multiple threads perform it concurrently.
+    static unsigned int features = 0u;
+    unsigned int f = __atomic_load_n(&features, __ATOMIC_RELAXED);
+    if (BOOST_UNLIKELY(f == 0u))
+    {
+        f = atomics::detail::detect_x86_cpu_features() | x86_cpu_features::detected;
+        __atomic_store_n(&features, f, __ATOMIC_RELAXED);
+    }
+
+    return f;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_DETAIL_X86_CPU_FEATURES_HPP_INCLUDED_
@@ -14,6 +14,7 @@
 #ifndef BOOST_ATOMIC_IPC_ATOMIC_REF_HPP_INCLUDED_
 #define BOOST_ATOMIC_IPC_ATOMIC_REF_HPP_INCLUDED_
 
+#include <utility>
 #include <type_traits>
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
@@ -23,6 +24,7 @@
 #include <boost/atomic/detail/classify.hpp>
 #include <boost/atomic/detail/atomic_ref_impl.hpp>
 #include <boost/atomic/detail/type_traits/is_trivially_copyable.hpp>
+#include <boost/atomic/detail/fetch_update.hpp>
 #include <boost/atomic/detail/header.hpp>
 
 #ifdef BOOST_HAS_PRAGMA_ONCE
@@ -71,6 +73,22 @@ public:
     {
         return this->load();
     }
+
+    //! Replaces the value with the result of \a fn called on the current value, returning the previous value. \a fn may be called multiple times.
+    template< typename Function >
+    BOOST_FORCEINLINE value_type fetch_update(Function fn, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(std::declval< Function& >()(std::declval< value_type const& >())))
+    {
+        return atomics::detail::fetch_update< ipc_atomic_ref const, value_type >(*this, fn, order);
+    }
+
+    //! Calls \a fn on a copy of the current value and stores the modified copy if \a fn returns \c true. Returns \c true if the value was modified.
+    template< typename Function >
+    BOOST_FORCEINLINE bool update_if(Function fn, memory_order order = memory_order_seq_cst) const
+        noexcept(noexcept(std::declval< Function& >()(std::declval< value_type& >())))
+    {
+        return atomics::detail::update_if< ipc_atomic_ref const, value_type >(*this, fn, order);
+    }
 };
 
 #if !defined(BOOST_NO_CXX17_DEDUCTION_GUIDES)
@@ -0,0 +1,164 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/lock_pool.hpp
+ *
+ * This header contains declarations of functions for configuring the lock pool used to implement lock-based atomic operations
+ * and waiting and notifying operations.
+ */
+
+#ifndef BOOST_ATOMIC_LOCK_POOL_HPP_INCLUDED_
+#define BOOST_ATOMIC_LOCK_POOL_HPP_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/link.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Sets the number of locks in the lock pool
+ *
+ * The size is rounded up to a power of two and limited to the maximum supported size. The lock pool size can only be set
+ * before the lock pool is first used, which happens on the first lock-based atomic operation or waiting or notifying operation.
+ *
+ * \returns \c true if the lock pool has the requested size after the call, \c false otherwise.
+ */
+BOOST_ATOMIC_DECL bool set_lock_pool_size(std::size_t size) noexcept;
+
+/*!
+ * \brief Returns the number of locks in the lock pool
+ *
+ * If the lock pool is not initialized yet, initializes it with the default size.
+ */
+BOOST_ATOMIC_DECL std::size_t get_lock_pool_size() noexcept;
+
+/*!
+ * \brief Reserves memory in the lock pool for the given number of concurrent blocking waiting operations
+ *
+ * Waiting operations that are implemented using the lock pool allocate memory for their state when an atomic object is first waited on.
+ * This function allows to allocate the memory in advance, so that waiting operations don't need to allocate memory while the lock pool
+ * is locked. The reserved memory is distributed evenly among the locks in the pool, so waiting operations may still need to allocate
+ * memory if their atomic objects are not evenly distributed between the locks.
+ *
+ * If the lock pool is not initialized yet, initializes it with the default size.
+ *
+ * \returns \c true if the memory was successfully reserved, \c false otherwise.
+ */
+BOOST_ATOMIC_DECL bool reserve_lock_pool_wait_states(std::size_t count) noexcept;
+
+/*!
+ * \brief Statistics of a lock pool entry
+ *
+ * The counters are accumulated since the lock pool initialization. Each lock pool entry contains a spin lock that is used by lock-based
+ * atomic operations and a mutex that is used by waiting and notifying operations.
+ */
+struct lock_pool_statistics
+{
+    //! Number of times the spin lock was acquired
+    std::uint64_t short_lock_count;
+    //! Number of times the spin lock was acquired after finding it locked by another thread
+    std::uint64_t contended_short_lock_count;
+    //! Number of times the mutex was acquired
+    std::uint64_t lock_count;
+    //! Number of times the mutex was acquired after finding it locked by another thread
+    std::uint64_t contended_lock_count;
+    //! Number of contended mutex acquisitions that succeeded while spinning, without blocking the thread
+    std::uint64_t spin_lock_count;
+    //! Number of times a thread blocked while acquiring the mutex
+    std::uint64_t blocked_lock_count;
+    //! Number of times a waiting operation on a single atomic object blocked the thread
+    std::uint64_t blocked_wait_count;
+    //! Number of waiting operations currently registered in the entry
+    std::uint64_t waiter_count;
+    //! Maximum number of waiting operations that were registered in the entry at the same time
+    std::uint64_t max_waiter_count;
+    //! Number of wait states the entry can hold without allocating memory
+    std::uint64_t wait_state_capacity;
+};
+
+/*!
+ * \brief Obtains statistics of the lock pool entry with the given index
+ *
+ * The statistics are only collected if \c BOOST_ATOMIC_LOCK_POOL_STATISTICS macro was defined when building the library.
+ * The function locks the mutex of the lock pool entry, and this acquisition is included in the returned statistics.
+ *
+ * If the lock pool is not initialized yet, initializes it with the default size.
+ *
+ * \returns \c true if \a stats was filled, \c false if the statistics are not collected or \a index is not less than the lock pool size.
+ */
+BOOST_ATOMIC_DECL bool get_lock_pool_statistics(std::size_t index, lock_pool_statistics& stats) noexcept;
+
+/*!
+ * \brief Returns the size of memory, in bytes, that is required for an IPC wait table with the given number of entries
+ *
+ * The number of entries is rounded up to a power of two and limited to the maximum supported number of entries.
+ * More entries reduce the chance of blocked threads being woken up by notifications on unrelated atomic objects.
+ *
+ * \returns The memory size, or 0 if IPC wait tables are not supported on the target platform.
+ */
+BOOST_ATOMIC_DECL std::size_t get_ipc_wait_table_size(std::size_t entry_count) noexcept;
+
+/*!
+ * \brief Initializes an IPC wait table in the given memory region
+ *
+ * The memory region is intended to be located in shared memory, and the table should be initialized by one of the processes before
+ * being attached in any process. The memory must be aligned at least to the alignment of \c std::max_align_t. The number of entries
+ * in the table is the max power of two that fits in the \a size bytes at \a memory.
+ *
+ * \a region_size is the size of the whole shared memory region that starts at \a memory and contains the table and the atomic
+ * objects, in bytes. It must not be less than \a size. Waiting operations on atomic objects located outside the region
+ * do not use the table.
+ *
+ * \returns \c true if the table was initialized, \c false otherwise.
+ */
+BOOST_ATOMIC_DECL bool create_ipc_wait_table(void* memory, std::size_t size, std::size_t region_size) noexcept;
+
+/*!
+ * \brief Destroys the IPC wait table previously initialized by \c create_ipc_wait_table
+ *
+ * The table must not be attached in any process when it is destroyed.
+ */
+BOOST_ATOMIC_DECL void destroy_ipc_wait_table(void* memory) noexcept;
+
+/*!
+ * \brief Attaches the IPC wait table to the current process
+ *
+ * After the table is attached, waiting operations of \c ipc_atomic and \c ipc_atomic_ref objects that are not natively
+ * supported by the target platform block on the table entries instead of spinning, and notifying operations unblock them.
+ * The atomic objects must be located in the same shared memory mapping as the table, within the region specified in
+ * \c create_ipc_wait_table. Waiting operations on atomic objects outside the region are implemented by spinning.
+ *
+ * Only one table can be attached at a time. Attaching a table replaces the previously attached one. There must be no waiting
+ * operations in progress when the table is attached or detached.
+ *
+ * \returns \c true if the table was attached, \c false if the table is not initialized or IPC wait tables are not supported.
+ */
+BOOST_ATOMIC_DECL bool attach_ipc_wait_table(void* memory) noexcept;
+
+/*!
+ * \brief Detaches the IPC wait table from the current process
+ *
+ * After the table is detached, waiting operations of \c ipc_atomic and \c ipc_atomic_ref objects that are not natively
+ * supported by the target platform are implemented by spinning.
+ */
+BOOST_ATOMIC_DECL void detach_ipc_wait_table() noexcept;
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_LOCK_POOL_HPP_INCLUDED_
@@ -0,0 +1,57 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/wait_any.hpp
+ *
+ * This header contains definition of \c wait_any function.
+ */
+
+#ifndef BOOST_ATOMIC_WAIT_ANY_HPP_INCLUDED_
+#define BOOST_ATOMIC_WAIT_ANY_HPP_INCLUDED_
+
+#include <cstddef>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/wait_any_impl.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Blocks until any of the atomic objects is notified and its value differs from the corresponding old value
+ *
+ * \param objects Pointers to the atomic objects. The objects must be \c atomic, \c atomic_ref, \c ipc_atomic or \c ipc_atomic_ref of the same type.
+ * \param old_values Old values of the atomic objects, one per object.
+ * \param count Number of atomic objects.
+ * \param order Memory order of the loads of the atomic values.
+ * \returns Index of an atomic object whose value differs from the old value. Returns \a count if \a count is zero.
+ */
+template< typename Atomic >
+BOOST_FORCEINLINE std::size_t wait_any(Atomic const* const* objects, typename Atomic::value_type const* old_values, std::size_t count, memory_order order = memory_order_seq_cst) noexcept
+{
+    BOOST_ASSERT(order != memory_order_release);
+    BOOST_ASSERT(order != memory_order_acq_rel);
+
+    return atomics::detail::wait_any_impl< Atomic >::wait_any(objects, old_values, count, order);
+}
+
+} // namespace atomics
+
+using atomics::wait_any;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_WAIT_ANY_HPP_INCLUDED_
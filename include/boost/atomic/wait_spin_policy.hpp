@@ -0,0 +1,66 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/wait_spin_policy.hpp
+ *
+ * This header contains definition of the \c wait_spin_policy structure.
+ */
+
+#ifndef BOOST_ATOMIC_WAIT_SPIN_POLICY_HPP_INCLUDED_
+#define BOOST_ATOMIC_WAIT_SPIN_POLICY_HPP_INCLUDED_
+
+#include <chrono>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+#if !defined(BOOST_ATOMIC_WAIT_SPIN_COUNT)
+//! Default number of spin iterations of waiting operations before blocking
+#define BOOST_ATOMIC_WAIT_SPIN_COUNT 0
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief The structure describes the spinning phase of a waiting operation
+ *
+ * Before blocking, the waiting operation repeatedly loads the atomic value and executes \c thread_pause between
+ * the loads, until the value changes or either of the limits is reached.
+ */
+struct wait_spin_policy
+{
+    //! Max number of spin iterations. Zero means the waiting operation blocks without spinning.
+    unsigned int max_iterations;
+    //! Max duration of spinning. Zero or negative duration means the spinning is only limited by \c max_iterations.
+    std::chrono::nanoseconds max_duration;
+
+    //! Initializes the policy with the default number of spin iterations, as specified by \c BOOST_ATOMIC_WAIT_SPIN_COUNT
+    constexpr wait_spin_policy() noexcept :
+        max_iterations(BOOST_ATOMIC_WAIT_SPIN_COUNT),
+        max_duration(0)
+    {
+    }
+
+    //! Initializes the policy with the specified limits
+    constexpr explicit wait_spin_policy(unsigned int iterations, std::chrono::nanoseconds duration = std::chrono::nanoseconds(0)) noexcept :
+        max_iterations(iterations),
+        max_duration(duration)
+    {
+    }
+};
+
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_WAIT_SPIN_POLICY_HPP_INCLUDED_
@@ -0,0 +1,298 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   atomic/waiter_tracking_atomic.hpp
+ *
+ * This header contains definition of \c waiter_tracking_atomic template.
+ */
+
+#ifndef BOOST_ATOMIC_WAITER_TRACKING_ATOMIC_HPP_INCLUDED_
+#define BOOST_ATOMIC_WAITER_TRACKING_ATOMIC_HPP_INCLUDED_
+
+#include <chrono>
+#include <utility>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/memory_order.hpp>
+#include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/classify.hpp>
+#include <boost/atomic/detail/bitwise_cast.hpp>
+#include <boost/atomic/detail/atomic_impl.hpp>
+#include <boost/atomic/detail/core_operations.hpp>
+#include <boost/atomic/detail/fence_operations.hpp>
+#include <boost/atomic/detail/aligned_variable.hpp>
+#include <boost/atomic/detail/wait_spin.hpp>
+#include <boost/atomic/detail/wait_any_fwd.hpp>
+#include <boost/atomic/detail/fetch_update.hpp>
+#include <boost/atomic/detail/type_traits/is_trivially_copyable.hpp>
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+#include <boost/atomic/detail/bitwise_fp_cast.hpp>
+#endif
+#include <boost/atomic/detail/header.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+
+/*!
+ * \brief Atomic object that tracks the number of threads blocked in waiting operations
+ *
+ * The object supports the same operations as \c atomic, but notifying operations do not unblock threads
+ * (which typically involves a system call) if no threads are blocked in waiting operations on the object.
+ */
+template< typename T >
+class waiter_tracking_atomic :
+    public atomics::detail::base_atomic< T, typename atomics::detail::classify< T >::type, false >
+{
+private:
+    using base_type = atomics::detail::base_atomic< T, typename atomics::detail::classify< T >::type, false >;
+    using value_arg_type = typename base_type::value_arg_type;
+    using core_operations = typename base_type::core_operations;
+    using wait_operations = typename base_type::wait_operations;
+    using storage_type = typename base_type::storage_type;
+    using counter_operations = atomics::detail::core_operations< 4u, false, false >;
+    using counter_storage_type = typename counter_operations::storage_type;
+
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    using use_fp_cast = std::is_same< typename atomics::detail::classify< T >::type, float >;
+#else
+    using use_fp_cast = std::false_type;
+#endif
+
+    //! Registers a waiting operation for the duration of its lifetime
+    class scoped_waiter
+    {
+    private:
+        counter_storage_type volatile& m_waiter_count;
+
+    public:
+        explicit scoped_waiter(counter_storage_type volatile& waiter_count) noexcept :
+            m_waiter_count(waiter_count)
+        {
+            counter_operations::fetch_add(m_waiter_count, 1u, memory_order_relaxed);
+            // Pairs with the fence in notifying operations. Either the waiting operation observes the new value of the atomic object,
+            // or the notifying operation observes the incremented counter.
+            atomics::detail::fence_operations::thread_fence(memory_order_seq_cst);
+        }
+
+        scoped_waiter(scoped_waiter const&) = delete;
+        scoped_waiter& operator=(scoped_waiter const&) = delete;
+
+        ~scoped_waiter() noexcept
+        {
+            counter_operations::fetch_sub(m_waiter_count, 1u, memory_order_relaxed);
+        }
+    };
+
+public:
+    using value_type = typename base_type::value_type;
+
+    static_assert(sizeof(value_type) > 0u, "boost::waiter_tracking_atomic<T> requires T to be a complete type");
+    static_assert(atomics::detail::is_trivially_copyable< value_type >::value, "boost::waiter_tracking_atomic<T> requires T to be a trivially copyable type");
+
+private:
+    //! Number of threads that may be blocked in waiting operations on this object
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR_TPL(counter_operations::storage_alignment, counter_storage_type, m_waiter_count);
+
+public:
+    BOOST_FORCEINLINE waiter_tracking_atomic() noexcept : m_waiter_count(0u)
+    {
+    }
+
+    BOOST_FORCEINLINE BOOST_ATOMIC_DETAIL_CONSTEXPR_ATOMIC_CTOR waiter_tracking_atomic(value_arg_type v) noexcept :
+        base_type(v),
+        m_waiter_count(0u)
+    {
+    }
+
+    waiter_tracking_atomic(waiter_tracking_atomic const&) = delete;
+    waiter_tracking_atomic& operator= (waiter_tracking_atomic const&) = delete;
+    waiter_tracking_atomic& operator= (waiter_tracking_atomic const&) volatile = delete;
+
+    BOOST_FORCEINLINE value_type operator= (value_arg_type v) noexcept
+    {
+        this->store(v);
+        return v;
+    }
+
+    BOOST_FORCEINLINE value_type operator= (value_arg_type v) volatile noexcept
+    {
+        this->store(v);
+        return v;
+    }
+
+    BOOST_FORCEINLINE operator value_type() const volatile noexcept
+    {
+        return this->load();
+    }
+
+    //! Replaces the value with the result of \a fn called on the current value, returning the previous value. \a fn may be called multiple times.
+    template< typename Function >
+    BOOST_FORCEINLINE value_type fetch_update(Function fn, memory_order order = memory_order_seq_cst) volatile
+        noexcept(noexcept(std::declval< Function& >()(std::declval< value_type const& >())))
+    {
+        return atomics::detail::fetch_update< waiter_tracking_atomic volatile, value_type >(*this, fn, order);
+    }
+
+    //! Calls \a fn on a copy of the current value and stores the modified copy if \a fn returns \c true. Returns \c true if the value was modified.
+    template< typename Function >
+    BOOST_FORCEINLINE bool update_if(Function fn, memory_order order = memory_order_seq_cst) volatile
+        noexcept(noexcept(std::declval< Function& >()(std::declval< value_type& >())))
+    {
+        return atomics::detail::update_if< waiter_tracking_atomic volatile, value_type >(*this, fn, order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        return wait(old_val, wait_spin_policy(), order);
+    }
+
+    BOOST_FORCEINLINE value_type wait(value_arg_type old_val, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile noexcept
+    {
+        BOOST_ASSERT(order != memory_order_release);
+        BOOST_ASSERT(order != memory_order_acq_rel);
+
+        const storage_type old_storage = to_storage(old_val, use_fp_cast());
+        storage_type new_storage = atomics::detail::wait_spin< wait_operations >(this->storage(), old_storage, order, spin);
+        if (new_storage == old_storage)
+        {
+            scoped_waiter waiter(get_waiter_count());
+            new_storage = wait_operations::wait(this->storage(), old_storage, order);
+        }
+
+        return from_storage(new_storage, use_fp_cast());
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(std::declval< base_type const volatile& >().wait_until(std::declval< value_arg_type >(), timeout, order)))
+    {
+        return wait_until(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Clock, typename Duration >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_until(value_arg_type old_val, std::chrono::time_point< Clock, Duration > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(std::declval< base_type const volatile& >().wait_until(std::declval< value_arg_type >(), timeout, order)))
+    {
+        BOOST_ASSERT(order != memory_order_release);
+        BOOST_ASSERT(order != memory_order_acq_rel);
+
+        const storage_type new_storage = atomics::detail::wait_spin_until< wait_operations >(this->storage(), to_storage(old_val, use_fp_cast()), timeout, order, spin);
+        if (new_storage != to_storage(old_val, use_fp_cast()))
+            return wait_result< value_type >(from_storage(new_storage, use_fp_cast()), false);
+
+        scoped_waiter waiter(get_waiter_count());
+        // The spinning phase is complete, block in the base class without spinning
+        return base_type::wait_until(old_val, timeout, wait_spin_policy(0u), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(std::declval< base_type const volatile& >().wait_for(std::declval< value_arg_type >(), timeout, order)))
+    {
+        return wait_for(old_val, timeout, wait_spin_policy(), order);
+    }
+
+    template< typename Rep, typename Period >
+    BOOST_FORCEINLINE wait_result< value_type >
+    wait_for(value_arg_type old_val, std::chrono::duration< Rep, Period > timeout, wait_spin_policy const& spin, memory_order order = memory_order_seq_cst) const volatile
+        noexcept(noexcept(std::declval< base_type const volatile& >().wait_for(std::declval< value_arg_type >(), timeout, order)))
+    {
+        BOOST_ASSERT(order != memory_order_release);
+        BOOST_ASSERT(order != memory_order_acq_rel);
+
+        if (spin.max_iterations == 0u)
+        {
+            scoped_waiter waiter(get_waiter_count());
+            return base_type::wait_for(old_val, timeout, spin, order);
+        }
+
+        // Convert the timeout to a deadline before spinning, so that the time spent spinning is not added to the timeout
+        const std::chrono::steady_clock::time_point deadline = atomics::detail::make_wait_deadline(timeout);
+        const storage_type new_storage = atomics::detail::wait_spin_until< wait_operations >(this->storage(), to_storage(old_val, use_fp_cast()), deadline, order, spin);
+        if (new_storage != to_storage(old_val, use_fp_cast()))
+            return wait_result< value_type >(from_storage(new_storage, use_fp_cast()), false);
+
+        scoped_waiter waiter(get_waiter_count());
+        // The spinning phase is complete, block in the base class without spinning
+        return base_type::wait_until(old_val, deadline, wait_spin_policy(0u), order);
+    }
+
+    BOOST_FORCEINLINE void notify_one() volatile noexcept
+    {
+        if (has_waiters())
+            wait_operations::notify_one(this->storage());
+    }
+
+    BOOST_FORCEINLINE void notify_all() volatile noexcept
+    {
+        if (has_waiters())
+            wait_operations::notify_all(this->storage());
+    }
+
+private:
+    BOOST_FORCEINLINE counter_storage_type volatile& get_waiter_count() const volatile noexcept
+    {
+        return const_cast< counter_storage_type volatile& >(m_waiter_count);
+    }
+
+    BOOST_FORCEINLINE bool has_waiters() const volatile noexcept
+    {
+        // Pairs with the fence in scoped_waiter constructor
+        atomics::detail::fence_operations::thread_fence(memory_order_seq_cst);
+        return counter_operations::load(m_waiter_count, memory_order_relaxed) != 0u;
+    }
+
+    static BOOST_FORCEINLINE storage_type to_storage(value_arg_type v, std::false_type) noexcept
+    {
+        return atomics::detail::bitwise_cast< storage_type >(v);
+    }
+
+    static BOOST_FORCEINLINE value_type from_storage(storage_type v, std::false_type) noexcept
+    {
+        return atomics::detail::bitwise_cast< value_type >(v);
+    }
+
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    static BOOST_FORCEINLINE storage_type to_storage(value_arg_type v, std::true_type) noexcept
+    {
+        return atomics::detail::bitwise_fp_cast< storage_type >(v);
+    }
+
+    static BOOST_FORCEINLINE value_type from_storage(storage_type v, std::true_type) noexcept
+    {
+        return atomics::detail::bitwise_fp_cast< value_type >(v);
+    }
+#endif
+};
+
+namespace detail {
+
+// Waiting for multiple objects would require registering in all of them
+template< typename T >
+struct is_wait_any_supported< atomics::waiter_tracking_atomic< T > > : public std::false_type {};
+
+} // namespace detail
+
+} // namespace atomics
+
+using atomics::waiter_tracking_atomic;
+
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ATOMIC_WAITER_TRACKING_ATOMIC_HPP_INCLUDED_
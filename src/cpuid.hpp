@@ -3,12 +3,12 @@
  * (See accompanying file LICENSE_1_0.txt or copy at
  * http://www.boost.org/LICENSE_1_0.txt)
  *
- * Copyright (c) 2020 Andrey Semashev
+ * Copyright (c) 2020-2025 Andrey Semashev
  */
 /*!
  * \file   cpuid.hpp
  *
- * This file contains declaration of \c cpuid function
+ * This file contains declaration of \c cpuid and \c xgetbv functions
  */
 
 #ifndef BOOST_ATOMIC_CPUID_HPP_INCLUDED_
@@ -75,6 +75,26 @@ inline void cpuid(std::uint32_t& eax, std::uint32_t& ebx, std::uint32_t& ecx, st
 #endif
 }
 
+//! The function invokes x86 xgetbv instruction to obtain the contents of the specified extended control register
+inline std::uint64_t xgetbv(std::uint32_t index)
+{
+#if defined(__GNUC__)
+    std::uint32_t eax = 0u, edx = 0u;
+    // Note: Using the opcode instead of the mnemonic for compatibility with older assemblers
+    __asm__ __volatile__
+    (
+        ".byte 0x0f, 0x01, 0xd0\n\t"
+            : "=a" (eax), "=d" (edx)
+            : "c" (index)
+    );
+    return (static_cast< std::uint64_t >(edx) << 32u) | eax;
+#elif defined(_MSC_VER)
+    return _xgetbv(index);
+#else
+#error "Boost.Atomic: Unsupported compiler, xgetbv instruction cannot be generated"
+#endif
+}
+
 } // namespace detail
 } // namespace atomics
 } // namespace boost
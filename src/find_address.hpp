@@ -3,7 +3,7 @@
  * (See accompanying file LICENSE_1_0.txt or copy at
  * http://www.boost.org/LICENSE_1_0.txt)
  *
- * Copyright (c) 2020 Andrey Semashev
+ * Copyright (c) 2020-2025 Andrey Semashev
  */
 /*!
  * \file   find_address.hpp
@@ -33,6 +33,8 @@ extern find_address_t find_address_generic;
 extern find_address_t find_address_sse2;
 #if BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8
 extern find_address_t find_address_sse41;
+extern find_address_t find_address_avx2;
+extern find_address_t find_address_avx512;
 #endif // BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8
 #endif // BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 || BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4)
 
@@ -0,0 +1,129 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   find_address_avx2.cpp
+ *
+ * This file contains AVX2 implementation of the \c find_address algorithm
+ */
+
+#include <boost/predef/architecture/x86.h>
+#include <boost/atomic/detail/int_sizes.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8)
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include "find_address.hpp"
+#include "bit_operation_tools.hpp"
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! AVX2 implementation of the \c find_address algorithm
+std::size_t find_address_avx2(const volatile void* addr, const volatile void* const* addrs, std::size_t size)
+{
+    if (size < 12u)
+        return find_address_generic(addr, addrs, size);
+
+    const __m256i mm_addr = _mm256_set1_epi64x((long long)(uintptr_t)addr);
+    std::size_t pos = 0u;
+    const std::size_t n = (size + 1u) & ~static_cast< std::size_t >(1u);
+    for (std::size_t m = n & ~static_cast< std::size_t >(15u); pos < m; pos += 16u)
+    {
+        __m256i mm1 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos));
+        __m256i mm2 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos + 4u));
+        __m256i mm3 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos + 8u));
+        __m256i mm4 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos + 12u));
+
+        mm1 = _mm256_cmpeq_epi64(mm1, mm_addr);
+        mm2 = _mm256_cmpeq_epi64(mm2, mm_addr);
+        mm3 = _mm256_cmpeq_epi64(mm3, mm_addr);
+        mm4 = _mm256_cmpeq_epi64(mm4, mm_addr);
+
+        // Quickly check if there are any matches before extracting the mask
+        __m256i mm_any = _mm256_or_si256(_mm256_or_si256(mm1, mm2), _mm256_or_si256(mm3, mm4));
+        if (!_mm256_testz_si256(mm_any, mm_any))
+        {
+            std::uint32_t mask = static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm1))) |
+                (static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm2))) << 4u) |
+                (static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm3))) << 8u) |
+                (static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm4))) << 12u);
+
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+    }
+
+    if ((n - pos) >= 8u)
+    {
+        __m256i mm1 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos));
+        __m256i mm2 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos + 4u));
+
+        mm1 = _mm256_cmpeq_epi64(mm1, mm_addr);
+        mm2 = _mm256_cmpeq_epi64(mm2, mm_addr);
+
+        std::uint32_t mask = static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm1))) |
+            (static_cast< std::uint32_t >(_mm256_movemask_pd(_mm256_castsi256_pd(mm2))) << 4u);
+        if (mask)
+        {
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+
+        pos += 8u;
+    }
+
+    if ((n - pos) >= 4u)
+    {
+        __m256i mm1 = _mm256_load_si256(reinterpret_cast< const __m256i* >(addrs + pos));
+
+        mm1 = _mm256_cmpeq_epi64(mm1, mm_addr);
+
+        std::uint32_t mask = _mm256_movemask_pd(_mm256_castsi256_pd(mm1));
+        if (mask)
+        {
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+
+        pos += 4u;
+    }
+
+    if (pos < n)
+    {
+        __m128i mm1 = _mm_load_si128(reinterpret_cast< const __m128i* >(addrs + pos));
+
+        mm1 = _mm_cmpeq_epi64(mm1, _mm256_castsi256_si128(mm_addr));
+        std::uint32_t mask = _mm_movemask_pd(_mm_castsi128_pd(mm1));
+        if (mask)
+        {
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+
+        pos += 2u;
+    }
+
+done:
+    return pos;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8)
@@ -0,0 +1,87 @@
+/*
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Copyright (c) 2025 Andrey Semashev
+ */
+/*!
+ * \file   find_address_avx512.cpp
+ *
+ * This file contains AVX-512 implementation of the \c find_address algorithm
+ */
+
+#include <boost/predef/architecture/x86.h>
+#include <boost/atomic/detail/int_sizes.hpp>
+
+#if BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8)
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/atomic/detail/config.hpp>
+#include <boost/atomic/detail/intptr.hpp>
+#include "find_address.hpp"
+#include "bit_operation_tools.hpp"
+
+#include <boost/atomic/detail/header.hpp>
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+//! AVX-512 implementation of the \c find_address algorithm
+std::size_t find_address_avx512(const volatile void* addr, const volatile void* const* addrs, std::size_t size)
+{
+    if (size < 8u)
+        return find_address_generic(addr, addrs, size);
+
+    const __m512i mm_addr = _mm512_set1_epi64((long long)(uintptr_t)addr);
+    std::size_t pos = 0u;
+    for (std::size_t m = size & ~static_cast< std::size_t >(31u); pos < m; pos += 32u)
+    {
+        __m512i mm1 = _mm512_load_si512(addrs + pos);
+        __m512i mm2 = _mm512_load_si512(addrs + pos + 8u);
+        __m512i mm3 = _mm512_load_si512(addrs + pos + 16u);
+        __m512i mm4 = _mm512_load_si512(addrs + pos + 24u);
+
+        std::uint32_t mask = static_cast< std::uint32_t >(_mm512_cmpeq_epi64_mask(mm1, mm_addr)) |
+            (static_cast< std::uint32_t >(_mm512_cmpeq_epi64_mask(mm2, mm_addr)) << 8u) |
+            (static_cast< std::uint32_t >(_mm512_cmpeq_epi64_mask(mm3, mm_addr)) << 16u) |
+            (static_cast< std::uint32_t >(_mm512_cmpeq_epi64_mask(mm4, mm_addr)) << 24u);
+        if (mask)
+        {
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+    }
+
+    // Process the remaining elements with masked loads, which do not access memory past the end of the array
+    while (pos < size)
+    {
+        const std::size_t count = size - pos;
+        const __mmask8 load_mask = count >= 8u ? static_cast< __mmask8 >(0xFFu) : static_cast< __mmask8 >((1u << count) - 1u);
+        __m512i mm1 = _mm512_maskz_load_epi64(load_mask, addrs + pos);
+
+        std::uint32_t mask = _mm512_mask_cmpeq_epi64_mask(load_mask, mm1, mm_addr);
+        if (mask)
+        {
+            pos += atomics::detail::count_trailing_zeros(mask);
+            goto done;
+        }
+
+        pos += count >= 8u ? 8u : count;
+    }
+
+done:
+    return pos;
+}
+
+} // namespace detail
+} // namespace atomics
+} // namespace boost
+
+#include <boost/atomic/detail/footer.hpp>
+
+#endif // BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8)
@@ -22,11 +22,13 @@
 #include <boost/predef/hardware/simd/x86.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <cstdlib>
 #include <new>
 #include <limits>
 #include <chrono>
+#include <thread>
 #include <boost/config.hpp>
 #include <boost/assert.hpp>
 #include <boost/memory_order.hpp>
@@ -41,12 +43,12 @@
 #include <boost/atomic/detail/fence_operations.hpp>
 #include <boost/atomic/detail/lock_pool.hpp>
 #include <boost/atomic/detail/once_flag.hpp>
+#include <boost/atomic/detail/tracepoint.hpp>
+#include <boost/atomic/lock_pool.hpp>
 #include <boost/atomic/detail/type_traits/alignment_of.hpp>
 
 #include <boost/align/aligned_alloc.hpp>
 
-#include <boost/preprocessor/config/limits.hpp>
-#include <boost/preprocessor/iteration/iterate.hpp>
 
 #if BOOST_OS_WINDOWS
 #include <type_traits>
@@ -64,24 +66,54 @@
 #include <unistd.h> // _POSIX_MONOTONIC_CLOCK
 #include <cerrno>
 #include <boost/atomic/detail/futex.hpp>
-#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2 && !defined(BOOST_ATOMIC_LOCK_POOL_USE_PTHREAD)
 #define BOOST_ATOMIC_USE_FUTEX
-#else // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2
+#else // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2 && !defined(BOOST_ATOMIC_LOCK_POOL_USE_PTHREAD)
 #include <pthread.h>
 #define BOOST_ATOMIC_USE_PTHREAD
-#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX) && BOOST_ATOMIC_INT32_LOCK_FREE == 2 && !defined(BOOST_ATOMIC_LOCK_POOL_USE_PTHREAD)
 #endif // BOOST_OS_WINDOWS
 
+#if BOOST_ATOMIC_THREAD_FENCE == 2
+// Emulated fences are implemented with the lock pool, so the lock-free protocols within the lock pool can only be used with native fences
+#define BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE
+#endif
+
 #include "find_address.hpp"
 
-#if BOOST_ARCH_X86 && (defined(BOOST_ATOMIC_USE_SSE2) || defined(BOOST_ATOMIC_USE_SSE41)) && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && \
-    (\
-        (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 && BOOST_HW_SIMD_X86 < BOOST_HW_SIMD_X86_SSE4_1_VERSION) || \
-        (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4 && BOOST_HW_SIMD_X86 < BOOST_HW_SIMD_X86_SSE2_VERSION) \
-    )
-#include "cpuid.hpp"
+// Select the best find_address implementation that is known to be supported by the target CPU at compile time,
+// or use runtime dispatch if a better implementation may be supported
+#if BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 || BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4)
+#if BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 && defined(BOOST_ATOMIC_USE_AVX512)
+#if defined(__AVX512F__)
+#define BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS find_address_avx512
+#else
+#define BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH
+#endif
+#elif BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 && defined(BOOST_ATOMIC_USE_AVX2)
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_AVX2_VERSION
+#define BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS find_address_avx2
+#else
 #define BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH
 #endif
+#elif BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 && defined(BOOST_ATOMIC_USE_SSE41)
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE4_1_VERSION
+#define BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS find_address_sse41
+#else
+#define BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH
+#endif
+#elif defined(BOOST_ATOMIC_USE_SSE2)
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+#define BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS find_address_sse2
+#else
+#define BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH
+#endif
+#endif
+#endif // BOOST_ARCH_X86 && defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 || BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4)
+
+#if defined(BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH)
+#include "cpuid.hpp"
+#endif
 
 #include <boost/atomic/detail/header.hpp>
 
@@ -115,8 +147,7 @@ namespace lock_pool {
 
 namespace {
 
-#if BOOST_ARCH_X86 && (defined(BOOST_ATOMIC_USE_SSE2) || defined(BOOST_ATOMIC_USE_SSE41)) && \
-    defined(BOOST_ATOMIC_DETAIL_SIZEOF_POINTER) && (BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 || BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4)
+#if defined(BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS) || defined(BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH)
 
 using func_ptr_operations = atomics::detail::core_operations< sizeof(find_address_t*), false, false >;
 static_assert(func_ptr_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for function pointers");
@@ -132,10 +163,8 @@ union find_address_ptr
 }
 g_find_address =
 {
-#if defined(BOOST_ATOMIC_USE_SSE41) && BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8 && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE4_1_VERSION
-    &find_address_sse41
-#elif defined(BOOST_ATOMIC_USE_SSE2) && BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 4 && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
-    &find_address_sse2
+#if defined(BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS)
+    &BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS
 #else
     &find_address_dispatch
 #endif
@@ -147,7 +176,7 @@ std::size_t find_address_dispatch(const volatile void* addr, const volatile void
 {
     find_address_t* find_addr = &find_address_generic;
 
-#if defined(BOOST_ATOMIC_USE_SSE2)
+#if defined(BOOST_ATOMIC_USE_SSE2) || defined(BOOST_ATOMIC_USE_SSE41) || defined(BOOST_ATOMIC_USE_AVX2) || defined(BOOST_ATOMIC_USE_AVX512)
     // First, check the max available cpuid function
     std::uint32_t eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
     atomics::detail::cpuid(eax, ebx, ecx, edx);
@@ -160,15 +189,42 @@ std::size_t find_address_dispatch(const volatile void* addr, const volatile void
         ebx = ecx = edx = 0u;
         atomics::detail::cpuid(eax, ebx, ecx, edx);
 
+#if defined(BOOST_ATOMIC_USE_SSE2)
         if ((edx & (1u << 26)) != 0u)
             find_addr = &find_address_sse2;
+#endif
 
 #if defined(BOOST_ATOMIC_USE_SSE41) && BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8
         if ((ecx & (1u << 19)) != 0u)
             find_addr = &find_address_sse41;
 #endif
+
+#if (defined(BOOST_ATOMIC_USE_AVX2) || defined(BOOST_ATOMIC_USE_AVX512)) && BOOST_ATOMIC_DETAIL_SIZEOF_POINTER == 8
+        // AVX registers can only be used if the OS saves and restores them on context switches, which is indicated by OSXSAVE and XCR0 bits
+        if ((ecx & (1u << 27)) != 0u && max_cpuid_function >= 7u)
+        {
+            const std::uint64_t xcr0 = atomics::detail::xgetbv(0u);
+
+            // Obtain extended CPU features
+            eax = 7u;
+            ebx = ecx = edx = 0u;
+            atomics::detail::cpuid(eax, ebx, ecx, edx);
+
+#if defined(BOOST_ATOMIC_USE_AVX2)
+            // XMM and YMM state
+            if ((ebx & (1u << 5)) != 0u && (xcr0 & 0x06u) == 0x06u)
+                find_addr = &find_address_avx2;
+#endif
+
+#if defined(BOOST_ATOMIC_USE_AVX512)
+            // XMM, YMM, opmask and ZMM state
+            if ((ebx & (1u << 16)) != 0u && (xcr0 & 0xE6u) == 0xE6u)
+                find_addr = &find_address_avx512;
+#endif
+        }
+#endif
     }
-#endif // defined(BOOST_ATOMIC_USE_SSE2)
+#endif // defined(BOOST_ATOMIC_USE_SSE2) || defined(BOOST_ATOMIC_USE_SSE41) || defined(BOOST_ATOMIC_USE_AVX2) || defined(BOOST_ATOMIC_USE_AVX512)
 
     find_address_ptr ptr = {};
     ptr.as_ptr = find_addr;
@@ -186,17 +242,237 @@ inline std::size_t find_address(const volatile void* addr, const volatile void*
     return ptr.as_ptr(addr, addrs, size);
 }
 
-#else // BOOST_ARCH_X86 && ...
+#else // defined(BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS) || defined(BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH)
 
 inline std::size_t find_address(const volatile void* addr, const volatile void* const* addrs, std::size_t size)
 {
     return atomics::detail::find_address_generic(addr, addrs, size);
 }
 
-#endif // BOOST_ARCH_X86 && ...
+#endif // defined(BOOST_ATOMIC_DETAIL_X86_STATIC_FIND_ADDRESS) || defined(BOOST_ATOMIC_DETAIL_X86_USE_RUNTIME_DISPATCH)
+
+using waiter_count_operations = atomics::detail::core_operations< sizeof(std::size_t), false, false >;
+static_assert(waiter_count_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for size_t");
+
+using sequence_operations = atomics::detail::core_operations< sizeof(std::size_t), false, false >;
+static_assert(sequence_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for size_t");
+
+/*!
+ * \brief Spin lock that is also used as a sequence counter by optimistic readers. Must be a POD structure.
+ *
+ * The lock is used to protect short critical sections of lock-based atomic operations. It never blocks the thread in the kernel.
+ * The lock is locked when the sequence counter is odd. Every lock and unlock operation increments the counter, which allows
+ * readers to detect concurrent modifications of the protected atomic objects.
+ */
+struct sequence_lock
+{
+    //! Maximum number of \c thread_pause calls in one backoff iteration
+    static constexpr unsigned int max_backoff = 64u;
+
+    //! Sequence counter
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(sequence_operations::storage_alignment, sequence_operations::storage_type, m_sequence);
+
+    //! Locks the spin lock. Returns \c true if the lock was not acquired on the first attempt.
+    bool lock() noexcept
+    {
+        bool contended = false;
+        sequence_operations::storage_type seq = sequence_operations::load(m_sequence, boost::memory_order_relaxed);
+        if (BOOST_UNLIKELY((seq & 1u) != 0u ||
+            !sequence_operations::compare_exchange_weak(m_sequence, seq, seq + 1u, boost::memory_order_acquire, boost::memory_order_relaxed)))
+        {
+            lock_slow_path();
+            contended = true;
+        }
+
+#if defined(BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE)
+        // Order the sequence counter increment before the following modifications of atomic objects, as observed by optimistic readers
+        atomics::detail::fence_operations::thread_fence(boost::memory_order_release);
+#endif
+
+        return contended;
+    }
+
+    //! Locks the spin lock, with exponential backoff
+    void lock_slow_path() noexcept
+    {
+        unsigned int backoff = 1u;
+        while (true)
+        {
+            for (unsigned int i = 0u; i < backoff; ++i)
+                atomics::thread_pause();
+
+            if (BOOST_LIKELY(backoff < max_backoff))
+                backoff *= 2u;
+            else
+                atomics::detail::wait_some(); // the lock owner is likely preempted, let it run
+
+            sequence_operations::storage_type seq = sequence_operations::load(m_sequence, boost::memory_order_relaxed);
+            if ((seq & 1u) == 0u &&
+                sequence_operations::compare_exchange_weak(m_sequence, seq, seq + 1u, boost::memory_order_acquire, boost::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+    }
+
+    //! Unlocks the spin lock
+    void unlock() noexcept
+    {
+        const sequence_operations::storage_type seq = sequence_operations::load(m_sequence, boost::memory_order_relaxed);
+        BOOST_ASSERT((seq & 1u) != 0u);
+        sequence_operations::store(m_sequence, seq + 1u, boost::memory_order_release);
+    }
+};
+
+#if !defined(BOOST_ATOMIC_DETAIL_NO_CXX11_ALIGNAS)
+#define BOOST_ATOMIC_SEQUENCE_LOCK_INIT { 0u }
+#else
+#define BOOST_ATOMIC_SEQUENCE_LOCK_INIT { { 0u } }
+#endif
+
+using spin_count_operations = atomics::detail::core_operations< sizeof(std::size_t), false, false >;
+static_assert(spin_count_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for size_t");
+
+/*!
+ * \brief Adaptive spinning state of a lock pool mutex. Must be a POD structure.
+ *
+ * The structure maintains a moving average of the number of spin iterations it took to acquire the mutex. The average
+ * is used to limit spinning on subsequent lock attempts, so that short critical sections are waited for in user space,
+ * while long critical sections promptly cause the waiting threads to block. This is similar to glibc adaptive mutexes.
+ */
+struct adaptive_spin
+{
+    //! Maximum number of spin iterations before blocking
+    static constexpr std::size_t max_spin_count = 100u;
+    //! Minimum number of spin iterations before blocking
+    static constexpr std::size_t min_spin_count = 10u;
+
+    //! Average number of spin iterations needed to acquire the mutex
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(spin_count_operations::storage_alignment, spin_count_operations::storage_type, m_average);
+
+    //! Returns the number of spin iterations to attempt before blocking
+    std::size_t get_spin_limit() const noexcept
+    {
+        const std::size_t limit = static_cast< std::size_t >(spin_count_operations::load(m_average, boost::memory_order_relaxed)) * 2u + min_spin_count;
+        return limit < max_spin_count ? limit : max_spin_count;
+    }
+
+    //! Updates the average with the number of spin iterations it took to acquire the mutex. Must be called with the mutex locked.
+    void update(std::size_t spin_count) noexcept
+    {
+        const std::size_t average = static_cast< std::size_t >(spin_count_operations::load(m_average, boost::memory_order_relaxed));
+        if (spin_count != average)
+        {
+            // average += (spin_count - average) / 8, in signed arithmetic
+            const std::size_t new_average = spin_count > average ? average + (spin_count - average) / 8u : average - (average - spin_count + 7u) / 8u;
+            spin_count_operations::store(m_average, static_cast< spin_count_operations::storage_type >(new_average), boost::memory_order_relaxed);
+        }
+    }
+};
+
+#if !defined(BOOST_ATOMIC_DETAIL_NO_CXX11_ALIGNAS)
+#define BOOST_ATOMIC_ADAPTIVE_SPIN_INIT { 0u }
+#else
+#define BOOST_ATOMIC_ADAPTIVE_SPIN_INIT { { 0u } }
+#endif
+
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+
+using statistics_counter_operations = atomics::detail::core_operations< sizeof(std::size_t), false, false >;
+static_assert(statistics_counter_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for size_t");
+
+/*!
+ * \brief Statistics of a lock pool entry. Must be a POD structure.
+ *
+ * The spin lock counters are only modified while the spin lock is locked, and the rest of the counters are only modified while
+ * the mutex is locked. This way the counters do not require atomic read-modify-write operations, but they can still be read without locking.
+ */
+struct lock_statistics
+{
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_short_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_contended_short_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_contended_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_spin_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_blocked_lock_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_blocked_wait_count);
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(statistics_counter_operations::storage_alignment, statistics_counter_operations::storage_type, m_max_waiter_count);
+
+    //! Records a spin lock acquisition. Must be called with the spin lock locked.
+    void record_short_lock(bool contended) noexcept
+    {
+        add(m_short_lock_count, 1u);
+        if (contended)
+            add(m_contended_short_lock_count, 1u);
+    }
+
+    //! Records a mutex acquisition that took the given number of spin iterations. Must be called with the mutex locked.
+    void record_lock(std::size_t spin_count, std::size_t spin_limit) noexcept
+    {
+        add(m_lock_count, 1u);
+        if (spin_count > 0u)
+        {
+            add(m_contended_lock_count, 1u);
+            if (spin_count < spin_limit)
+                add(m_spin_lock_count, 1u);
+        }
+    }
+
+    //! Records the number of times a thread blocked while acquiring the mutex. Must be called with the mutex locked.
+    void record_blocked_lock(std::size_t count) noexcept
+    {
+        add(m_blocked_lock_count, count);
+    }
+
+    //! Records a blocking waiting operation. Must be called with the mutex locked.
+    void record_blocked_wait() noexcept
+    {
+        add(m_blocked_wait_count, 1u);
+    }
+
+    //! Records the current number of registered waiting operations. Must be called with the mutex locked.
+    void record_waiter_count(std::size_t waiter_count) noexcept
+    {
+        if (waiter_count > static_cast< std::size_t >(statistics_counter_operations::load(m_max_waiter_count, boost::memory_order_relaxed)))
+            statistics_counter_operations::store(m_max_waiter_count, static_cast< statistics_counter_operations::storage_type >(waiter_count), boost::memory_order_relaxed);
+    }
+
+    //! Returns the value of a counter. Can be called without locking.
+    static std::uint64_t get(statistics_counter_operations::storage_type const& counter) noexcept
+    {
+        return static_cast< std::uint64_t >(statistics_counter_operations::load(counter, boost::memory_order_relaxed));
+    }
+
+private:
+    static void add(statistics_counter_operations::storage_type& counter, std::size_t value) noexcept
+    {
+        statistics_counter_operations::store(counter, statistics_counter_operations::load(counter, boost::memory_order_relaxed) + value, boost::memory_order_relaxed);
+    }
+};
+
+// Appended to the lock pool entry initializers, value-initializes the statistics
+#define BOOST_ATOMIC_LOCK_STATISTICS_INIT , {}
+
+#else // defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+
+#define BOOST_ATOMIC_LOCK_STATISTICS_INIT
+
+#endif // defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
 
 struct wait_state;
 struct lock_state;
+struct wait_any_token;
+
+//! Link between a wait state and a wait_any operation blocked on the associated atomic object
+struct wait_any_link
+{
+    //! Next link in the list of wait_any operations attached to the wait state
+    wait_any_link* m_next;
+    //! Wait state the link is attached to
+    wait_state* m_wait_state;
+    //! Wake token of the wait_any operation
+    wait_any_token* m_token;
+};
 
 //! Base class for a wait state
 struct wait_state_base
@@ -205,15 +481,41 @@ struct wait_state_base
     std::size_t m_ref_count;
     //! Index of this wait state in the list
     std::size_t m_index;
+    //! List of wait_any operations blocked on the atomic object
+    wait_any_link* m_wait_any_links;
 
     explicit wait_state_base(std::size_t index) noexcept :
         m_ref_count(0u),
-        m_index(index)
+        m_index(index),
+        m_wait_any_links(nullptr)
     {
     }
 
     wait_state_base(wait_state_base const&) = delete;
     wait_state_base& operator= (wait_state_base const&) = delete;
+
+    //! Attaches a wait_any operation to the wait state. Must be called with the lock pool entry locked.
+    void add_wait_any_link(wait_any_link* link) noexcept
+    {
+        link->m_next = m_wait_any_links;
+        m_wait_any_links = link;
+    }
+
+    //! Detaches a wait_any operation from the wait state. Must be called with the lock pool entry locked.
+    void remove_wait_any_link(wait_any_link* link) noexcept
+    {
+        wait_any_link** prev = &m_wait_any_links;
+        while (*prev != link)
+        {
+            BOOST_ASSERT(*prev != nullptr);
+            prev = &(*prev)->m_next;
+        }
+
+        *prev = link->m_next;
+    }
+
+    //! Wakes up all wait_any operations attached to the wait state. Must be called with the lock pool entry locked.
+    void notify_wait_any() noexcept;
 };
 
 //! List of wait states. Must be a POD structure.
@@ -236,20 +538,46 @@ struct wait_state_list
      * and the rest are spare elements. Spare wait_state structures may still be allocated (in which case the wait_state pointer is not null) and
      * can be reused on future requests. Spare atomic pointers are null and unused.
      *
+     * If the capacity is at least \c hash_index_min_capacity, the buffer contains a fourth area, which is an open addressing hash table
+     * with linear probing of 2 * header.capacity elements. Each non-zero element of the table is an index of an element in the array
+     * of atomic pointers, plus one. Zero elements are empty.
+     *
      * This memory layout was designed to optimize wait state lookup by atomic address and also support memory pooling to reduce dynamic memory allocations.
+     * For small lists, the lookup is a linear vectorized search in the array of atomic pointers, and for large lists the hash table is used.
      */
     header* m_header;
+    /*!
+     * \brief Number of wait operations that registered a wait state in the list
+     *
+     * The counter is only modified while the lock pool entry is locked, but it can be read without locking. This allows
+     * notifying operations to avoid locking the lock pool entry when there are no waiters, which is the common case.
+     */
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(waiter_count_operations::storage_alignment, waiter_count_operations::storage_type, m_waiter_count);
     //! The flag indicates that memory pooling is disabled. Set on process cleanup.
     bool m_free_memory;
 
     //! Buffer alignment, in bytes
-    static constexpr std::size_t buffer_alignment = 16u;
-    //! Alignment of pointer arrays in the buffer, in bytes. This should align atomic pointers to the vector size used in \c find_address implementation.
-    static constexpr std::size_t entries_alignment = atomics::detail::alignment_of< void* >::value < 16u ? 16u : atomics::detail::alignment_of< void* >::value;
+    static constexpr std::size_t buffer_alignment = 64u;
+    //! Alignment of pointer arrays in the buffer, in bytes. This should align atomic pointers to the largest vector size used in \c find_address implementations.
+    static constexpr std::size_t entries_alignment = atomics::detail::alignment_of< void* >::value < 64u ? 64u : atomics::detail::alignment_of< void* >::value;
     //! Offset from the list header to the beginning of the array of atomic pointers in the buffer, in bytes
     static constexpr std::size_t entries_offset = (sizeof(header) + entries_alignment - 1u) & ~static_cast< std::size_t >(entries_alignment - 1u);
     //! Initial buffer capacity, in elements. This should be at least as large as a vector size used in \c find_address implementation.
     static constexpr std::size_t initial_capacity = (16u / sizeof(void*)) < 2u ? 2u : (16u / sizeof(void*));
+    //! Minimum buffer capacity, in elements, at which the hash index is used for lookups. Must be a power of two.
+    static constexpr std::size_t hash_index_min_capacity = 64u;
+
+    //! Returns \c true if the buffer with the given capacity contains a hash index
+    static constexpr bool has_hash_index(std::size_t capacity) noexcept
+    {
+        return capacity >= hash_index_min_capacity;
+    }
+
+    //! Returns the size of the buffer with the given capacity, in bytes
+    static constexpr std::size_t get_buffer_size(std::size_t capacity) noexcept
+    {
+        return entries_offset + capacity * sizeof(void*) * 2u + (has_hash_index(capacity) ? capacity * 2u * sizeof(std::size_t) : 0u);
+    }
 
     //! Returns a pointer to the array of atomic pointers
     static const volatile void** get_atomic_pointers(header* p) noexcept
@@ -282,6 +610,80 @@ struct wait_state_list
         return get_wait_states(m_header);
     }
 
+    //! Returns a pointer to the hash index. Must only be called if the buffer contains the hash index.
+    static std::size_t* get_hash_index(header* p) noexcept
+    {
+        BOOST_ASSERT(has_hash_index(p->capacity));
+        return reinterpret_cast< std::size_t* >(get_wait_states(p) + p->capacity);
+    }
+
+    //! Returns the hash index position at which the search for the atomic object should start
+    static std::size_t hash_address(const volatile void* addr, std::size_t hash_index_mask) noexcept
+    {
+        // Lock pool entries are selected based on the lower bits of the address, so all addresses in the list likely have the same lower bits.
+        // Mix the higher bits into the lower ones to obtain a good distribution in the hash index.
+        atomics::detail::uintptr_t h = reinterpret_cast< atomics::detail::uintptr_t >(addr);
+#if BOOST_ATOMIC_DETAIL_SIZEOF_POINTER >= 8
+        h ^= h >> 33u;
+        h *= static_cast< atomics::detail::uintptr_t >(0xff51afd7ed558ccdull);
+        h ^= h >> 33u;
+#else
+        h ^= h >> 16u;
+        h *= static_cast< atomics::detail::uintptr_t >(0x85ebca6bu);
+        h ^= h >> 13u;
+#endif
+        return static_cast< std::size_t >(h) & hash_index_mask;
+    }
+
+    //! Returns the hash index position that refers to the element with the given index. The element must be present in the hash index.
+    static std::size_t find_hash_index_position(header* p, std::size_t index) noexcept
+    {
+        std::size_t* hash_index = get_hash_index(p);
+        const std::size_t hash_index_mask = p->capacity * 2u - 1u;
+        std::size_t pos = hash_address(get_atomic_pointers(p)[index], hash_index_mask);
+        while (hash_index[pos] != index + 1u)
+        {
+            BOOST_ASSERT(hash_index[pos] != 0u);
+            pos = (pos + 1u) & hash_index_mask;
+        }
+
+        return pos;
+    }
+
+    //! Adds the element with the given index to the hash index
+    static void insert_hash_index(header* p, std::size_t index) noexcept
+    {
+        std::size_t* hash_index = get_hash_index(p);
+        const std::size_t hash_index_mask = p->capacity * 2u - 1u;
+        std::size_t pos = hash_address(get_atomic_pointers(p)[index], hash_index_mask);
+        while (hash_index[pos] != 0u)
+            pos = (pos + 1u) & hash_index_mask;
+
+        hash_index[pos] = index + 1u;
+    }
+
+    //! Removes the element with the given index from the hash index
+    static void erase_hash_index(header* p, std::size_t index) noexcept
+    {
+        std::size_t* hash_index = get_hash_index(p);
+        const volatile void* const* addrs = get_atomic_pointers(p);
+        const std::size_t hash_index_mask = p->capacity * 2u - 1u;
+        std::size_t hole_pos = find_hash_index_position(p, index);
+
+        // Move the following elements of the probe sequence into the hole, if the hole is between their starting and current positions
+        for (std::size_t pos = (hole_pos + 1u) & hash_index_mask; hash_index[pos] != 0u; pos = (pos + 1u) & hash_index_mask)
+        {
+            const std::size_t start_pos = hash_address(addrs[hash_index[pos] - 1u], hash_index_mask);
+            if (((pos - start_pos) & hash_index_mask) >= ((pos - hole_pos) & hash_index_mask))
+            {
+                hash_index[hole_pos] = hash_index[pos];
+                hole_pos = pos;
+            }
+        }
+
+        hash_index[hole_pos] = 0u;
+    }
+
     //! Finds an element with the given pointer to the atomic object
     wait_state* find(const volatile void* addr) const noexcept
     {
@@ -289,19 +691,70 @@ struct wait_state_list
         if (BOOST_LIKELY(m_header != nullptr))
         {
             const volatile void* const* addrs = get_atomic_pointers();
-            const std::size_t size = m_header->size;
-            std::size_t pos = find_address(addr, addrs, size);
-            if (pos < size)
-                ws = get_wait_states()[pos];
+            if (BOOST_LIKELY(!has_hash_index(m_header->capacity)))
+            {
+                const std::size_t size = m_header->size;
+                std::size_t pos = find_address(addr, addrs, size);
+                if (pos < size)
+                    ws = get_wait_states()[pos];
+            }
+            else
+            {
+                const std::size_t* hash_index = get_hash_index(m_header);
+                const std::size_t hash_index_mask = m_header->capacity * 2u - 1u;
+                for (std::size_t pos = hash_address(addr, hash_index_mask); hash_index[pos] != 0u; pos = (pos + 1u) & hash_index_mask)
+                {
+                    const std::size_t index = hash_index[pos] - 1u;
+                    if (addrs[index] == addr)
+                    {
+                        ws = get_wait_states()[index];
+                        break;
+                    }
+                }
+            }
         }
 
         return ws;
     }
 
+    //! Returns the pointer to the atomic object associated with the wait state. Must be called with the lock pool entry locked.
+    const volatile void* get_address(wait_state const* w) const noexcept;
+
+    //! Registers a wait operation. Must be called with the lock pool entry locked.
+    void add_waiter() noexcept
+    {
+        waiter_count_operations::store(m_waiter_count, waiter_count_operations::load(m_waiter_count, boost::memory_order_relaxed) + 1u, boost::memory_order_relaxed);
+#if defined(BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE)
+        // The fence orders the counter increment before the following load of the atomic value in the waiting thread.
+        // Pairs with the fence in has_waiters, which orders the store of the atomic value before the load of the counter in the notifying thread.
+        atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+#endif
+    }
+
+    //! Unregisters a wait operation. Must be called with the lock pool entry locked.
+    void remove_waiter() noexcept
+    {
+        BOOST_ASSERT(waiter_count_operations::load(m_waiter_count, boost::memory_order_relaxed) > 0u);
+        waiter_count_operations::store(m_waiter_count, waiter_count_operations::load(m_waiter_count, boost::memory_order_relaxed) - 1u, boost::memory_order_relaxed);
+    }
+
+    //! Returns \c true if there may be wait operations registered in the list. Can be called without locking the lock pool entry.
+    bool has_waiters() const noexcept
+    {
+#if defined(BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE)
+        atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+        return waiter_count_operations::load(m_waiter_count, boost::memory_order_relaxed) != 0u;
+#else
+        return true;
+#endif
+    }
+
     //! Finds an existing element with the given pointer to the atomic object or allocates a new one. Returns nullptr in case of failure.
     wait_state* find_or_create(const volatile void* addr) noexcept;
     //! Releases the previously created wait state
     void erase(wait_state* w) noexcept;
+    //! Makes sure the list buffer has capacity for at least the given number of elements. Returns \c false in case of failure.
+    bool reserve(std::size_t capacity) noexcept;
 
     //! Deallocates spare entries and the list buffer if no allocated entries are left
     void free_spare() noexcept;
@@ -309,7 +762,11 @@ struct wait_state_list
     static header* allocate_buffer(std::size_t new_capacity, header* old_header = nullptr) noexcept;
 };
 
-#define BOOST_ATOMIC_WAIT_STATE_LIST_INIT { nullptr, false }
+#if !defined(BOOST_ATOMIC_DETAIL_NO_CXX11_ALIGNAS)
+#define BOOST_ATOMIC_WAIT_STATE_LIST_INIT { nullptr, 0u, false }
+#else
+#define BOOST_ATOMIC_WAIT_STATE_LIST_INIT { nullptr, { 0u }, false }
+#endif
 
 // In the platform-specific definitions below, lock_state must be a POD structure and wait_state must derive from wait_state_base.
 
@@ -404,27 +861,58 @@ struct lock_state
 {
     //! Mutex
     pthread_mutex_t m_mutex;
+    //! Adaptive spinning state
+    adaptive_spin m_spin;
+    //! Spin lock for short critical sections
+    sequence_lock m_short_lock;
     //! Wait states
     wait_state_list m_wait_states;
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+    //! Statistics
+    lock_statistics m_stats;
+#endif
 
-    //! Locks the mutex for a short duration
+    //! Locks the spin lock for a short duration
     void short_lock() noexcept
     {
-        long_lock();
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        m_stats.record_short_lock(m_short_lock.lock());
+#else
+        m_short_lock.lock();
+#endif
+    }
+
+    //! Unlocks the spin lock
+    void short_unlock() noexcept
+    {
+        m_short_lock.unlock();
     }
 
     //! Locks the mutex for a long duration
     void long_lock() noexcept
     {
-        for (unsigned int i = 0u; i < 5u; ++i)
+        const std::size_t spin_limit = m_spin.get_spin_limit();
+        std::size_t spin_count = 0u;
+        while (pthread_mutex_trylock(&m_mutex) != 0)
         {
-            if (BOOST_LIKELY(pthread_mutex_trylock(&m_mutex) == 0))
-                return;
+            if (++spin_count >= spin_limit)
+            {
+                BOOST_ATOMIC_DETAIL_TRACEPOINT1(lock_wait_start, this);
+                BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+                BOOST_ATOMIC_DETAIL_TRACEPOINT1(lock_wait_done, this);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+                m_stats.record_blocked_lock(1u);
+#endif
+                break;
+            }
 
             atomics::thread_pause();
         }
 
-        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        m_spin.update(spin_count);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        m_stats.record_lock(spin_count, spin_limit);
+#endif
     }
 
     //! Unlocks the mutex
@@ -434,7 +922,61 @@ struct lock_state
     }
 };
 
-#define BOOST_ATOMIC_LOCK_STATE_INIT { PTHREAD_MUTEX_INITIALIZER, BOOST_ATOMIC_WAIT_STATE_LIST_INIT }
+#define BOOST_ATOMIC_LOCK_STATE_INIT { PTHREAD_MUTEX_INITIALIZER, BOOST_ATOMIC_ADAPTIVE_SPIN_INIT, BOOST_ATOMIC_SEQUENCE_LOCK_INIT, BOOST_ATOMIC_WAIT_STATE_LIST_INIT BOOST_ATOMIC_LOCK_STATISTICS_INIT }
+
+//! Wake token of a wait_any operation
+struct wait_any_token
+{
+    //! Mutex
+    pthread_mutex_t m_mutex;
+    //! Condition variable
+    pthread_cond_t m_cond;
+    //! Number of notifications
+    std::uint32_t m_notify_count;
+
+    wait_any_token() noexcept :
+        m_notify_count(0u)
+    {
+        BOOST_VERIFY(pthread_mutex_init(&m_mutex, nullptr) == 0);
+        BOOST_VERIFY(pthread_cond_init(&m_cond, nullptr) == 0);
+    }
+
+    ~wait_any_token() noexcept
+    {
+        pthread_cond_destroy(&m_cond);
+        pthread_mutex_destroy(&m_mutex);
+    }
+
+    wait_any_token(wait_any_token const&) = delete;
+    wait_any_token& operator= (wait_any_token const&) = delete;
+
+    //! Returns the number of notifications
+    std::uint32_t get_notify_count() noexcept
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        const std::uint32_t notify_count = m_notify_count;
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+        return notify_count;
+    }
+
+    //! Blocks until the number of notifications changes from the given value
+    void wait(std::uint32_t notify_count) noexcept
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        while (m_notify_count == notify_count)
+            BOOST_VERIFY(pthread_cond_wait(&m_cond, &m_mutex) == 0);
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+    }
+
+    //! Wakes up the blocked wait_any operation
+    void notify() noexcept
+    {
+        BOOST_VERIFY(pthread_mutex_lock(&m_mutex) == 0);
+        ++m_notify_count;
+        BOOST_VERIFY(pthread_cond_signal(&m_cond) == 0);
+        BOOST_VERIFY(pthread_mutex_unlock(&m_mutex) == 0);
+    }
+};
 
 //! Blocks in the wait operation until notified
 inline void wait_state::wait(lock_state& state) noexcept
@@ -559,37 +1101,70 @@ struct lock_state
 {
     //! Mutex futex
     BOOST_ATOMIC_DETAIL_ALIGNED_VAR(futex_operations::storage_alignment, futex_operations::storage_type, m_mutex);
+    //! Adaptive spinning state
+    adaptive_spin m_spin;
+    //! Spin lock for short critical sections
+    sequence_lock m_short_lock;
     //! Wait states
     wait_state_list m_wait_states;
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+    //! Statistics
+    lock_statistics m_stats;
+#endif
 
-    //! Locks the mutex for a short duration
+    //! Locks the spin lock for a short duration
     void short_lock() noexcept
     {
-        long_lock();
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        m_stats.record_short_lock(m_short_lock.lock());
+#else
+        m_short_lock.lock();
+#endif
+    }
+
+    //! Unlocks the spin lock
+    void short_unlock() noexcept
+    {
+        m_short_lock.unlock();
     }
 
     //! Locks the mutex for a long duration
     void long_lock() noexcept
     {
-        for (unsigned int i = 0u; i < 10u; ++i)
+        const std::size_t spin_limit = m_spin.get_spin_limit();
+        std::size_t spin_count = 0u;
+        while (true)
         {
             futex_operations::storage_type prev_state = futex_operations::load(m_mutex, boost::memory_order_relaxed);
             if (BOOST_LIKELY((prev_state & mutex_bits::locked) == 0u))
             {
                 futex_operations::storage_type new_state = prev_state | mutex_bits::locked;
                 if (BOOST_LIKELY(futex_operations::compare_exchange_strong(m_mutex, prev_state, new_state, boost::memory_order_acquire, boost::memory_order_relaxed)))
-                    return;
+                    break;
+            }
+
+            if (++spin_count >= spin_limit)
+            {
+                lock_slow_path();
+                break;
             }
 
             atomics::thread_pause();
         }
 
-        lock_slow_path();
+        m_spin.update(spin_count);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        m_stats.record_lock(spin_count, spin_limit);
+#endif
     }
 
     //! Locks the mutex for a long duration
     void lock_slow_path() noexcept
     {
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(lock_wait_start, this);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        std::size_t futex_wait_count = 0u;
+#endif
         futex_operations::storage_type prev_state = futex_operations::load(m_mutex, boost::memory_order_relaxed);
         while (true)
         {
@@ -597,7 +1172,13 @@ struct lock_state
             {
                 futex_operations::storage_type new_state = prev_state | mutex_bits::locked;
                 if (BOOST_LIKELY(futex_operations::compare_exchange_weak(m_mutex, prev_state, new_state, boost::memory_order_acquire, boost::memory_order_relaxed)))
+                {
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+                    m_stats.record_blocked_lock(futex_wait_count);
+#endif
+                    BOOST_ATOMIC_DETAIL_TRACEPOINT1(lock_wait_done, this);
                     return;
+                }
             }
             else
             {
@@ -605,6 +1186,9 @@ struct lock_state
                 if (BOOST_LIKELY(futex_operations::compare_exchange_weak(m_mutex, prev_state, new_state, boost::memory_order_relaxed, boost::memory_order_relaxed)))
                 {
                     atomics::detail::futex_wait(&m_mutex, new_state, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+                    ++futex_wait_count;
+#endif
                     prev_state = futex_operations::load(m_mutex, boost::memory_order_relaxed);
                 }
             }
@@ -637,11 +1221,47 @@ struct lock_state
 };
 
 #if !defined(BOOST_ATOMIC_DETAIL_NO_CXX11_ALIGNAS)
-#define BOOST_ATOMIC_LOCK_STATE_INIT { 0u, BOOST_ATOMIC_WAIT_STATE_LIST_INIT }
+#define BOOST_ATOMIC_LOCK_STATE_INIT { 0u, BOOST_ATOMIC_ADAPTIVE_SPIN_INIT, BOOST_ATOMIC_SEQUENCE_LOCK_INIT, BOOST_ATOMIC_WAIT_STATE_LIST_INIT BOOST_ATOMIC_LOCK_STATISTICS_INIT }
 #else
-#define BOOST_ATOMIC_LOCK_STATE_INIT { { 0u }, BOOST_ATOMIC_WAIT_STATE_LIST_INIT }
+#define BOOST_ATOMIC_LOCK_STATE_INIT { { 0u }, BOOST_ATOMIC_ADAPTIVE_SPIN_INIT, BOOST_ATOMIC_SEQUENCE_LOCK_INIT, BOOST_ATOMIC_WAIT_STATE_LIST_INIT BOOST_ATOMIC_LOCK_STATISTICS_INIT }
 #endif
 
+//! Wake token of a wait_any operation
+struct wait_any_token
+{
+    //! Futex. Used as the counter of notifications.
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(futex_operations::storage_alignment, futex_operations::storage_type, m_notify_count);
+
+    wait_any_token() noexcept :
+        m_notify_count(0u)
+    {
+    }
+
+    wait_any_token(wait_any_token const&) = delete;
+    wait_any_token& operator= (wait_any_token const&) = delete;
+
+    //! Returns the number of notifications
+    futex_operations::storage_type get_notify_count() noexcept
+    {
+        // Pairs with the release operation in notify() to make the modified atomic value visible to the waiting thread
+        return futex_operations::load(m_notify_count, boost::memory_order_acquire);
+    }
+
+    //! Blocks until the number of notifications changes from the given value
+    void wait(futex_operations::storage_type notify_count) noexcept
+    {
+        while (futex_operations::load(m_notify_count, boost::memory_order_relaxed) == notify_count)
+            atomics::detail::futex_wait(&m_notify_count, notify_count, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+    }
+
+    //! Wakes up the blocked wait_any operation
+    void notify() noexcept
+    {
+        futex_operations::fetch_add(m_notify_count, 1u, boost::memory_order_release);
+        atomics::detail::futex_signal(&m_notify_count, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+    }
+};
+
 //! Blocks in the wait operation until notified
 inline void wait_state::wait(lock_state& state) noexcept
 {
@@ -864,20 +1484,47 @@ struct lock_state
 {
     //! Mutex
     boost::winapi::SRWLOCK_ m_mutex;
+    //! Spin lock for short critical sections
+    sequence_lock m_short_lock;
     //! Wait states
     wait_state_list m_wait_states;
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+    //! Statistics
+    lock_statistics m_stats;
+#endif
 
-    //! Locks the mutex for a short duration
+    //! Locks the spin lock for a short duration
     void short_lock() noexcept
     {
-        long_lock();
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        m_stats.record_short_lock(m_short_lock.lock());
+#else
+        m_short_lock.lock();
+#endif
+    }
+
+    //! Unlocks the spin lock
+    void short_unlock() noexcept
+    {
+        m_short_lock.unlock();
     }
 
     //! Locks the mutex for a long duration
     void long_lock() noexcept
     {
         // Presumably, AcquireSRWLockExclusive already implements spinning internally, so there's no point in doing this ourselves.
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        // Spinning is not observable, so all contended acquisitions are accounted as blocking
+        const bool contended = !boost::winapi::TryAcquireSRWLockExclusive(&m_mutex);
+        if (contended)
+        {
+            boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+            m_stats.record_blocked_lock(1u);
+        }
+        m_stats.record_lock(contended ? 1u : 0u, 1u);
+#else
         boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+#endif
     }
 
     //! Unlocks the mutex
@@ -887,7 +1534,55 @@ struct lock_state
     }
 };
 
-#define BOOST_ATOMIC_LOCK_STATE_INIT { BOOST_WINAPI_SRWLOCK_INIT, BOOST_ATOMIC_WAIT_STATE_LIST_INIT }
+#define BOOST_ATOMIC_LOCK_STATE_INIT { BOOST_WINAPI_SRWLOCK_INIT, BOOST_ATOMIC_SEQUENCE_LOCK_INIT, BOOST_ATOMIC_WAIT_STATE_LIST_INIT BOOST_ATOMIC_LOCK_STATISTICS_INIT }
+
+//! Wake token of a wait_any operation
+struct wait_any_token
+{
+    //! Mutex
+    boost::winapi::SRWLOCK_ m_mutex;
+    //! Condition variable
+    boost::winapi::CONDITION_VARIABLE_ m_cond;
+    //! Number of notifications
+    std::uint32_t m_notify_count;
+
+    wait_any_token() noexcept :
+        m_notify_count(0u)
+    {
+        boost::winapi::InitializeSRWLock(&m_mutex);
+        boost::winapi::InitializeConditionVariable(&m_cond);
+    }
+
+    wait_any_token(wait_any_token const&) = delete;
+    wait_any_token& operator= (wait_any_token const&) = delete;
+
+    //! Returns the number of notifications
+    std::uint32_t get_notify_count() noexcept
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+        const std::uint32_t notify_count = m_notify_count;
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+        return notify_count;
+    }
+
+    //! Blocks until the number of notifications changes from the given value
+    void wait(std::uint32_t notify_count) noexcept
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+        while (m_notify_count == notify_count)
+            boost::winapi::SleepConditionVariableSRW(&m_cond, &m_mutex, boost::winapi::infinite, 0u);
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+    }
+
+    //! Wakes up the blocked wait_any operation
+    void notify() noexcept
+    {
+        boost::winapi::AcquireSRWLockExclusive(&m_mutex);
+        ++m_notify_count;
+        boost::winapi::ReleaseSRWLockExclusive(&m_mutex);
+        boost::winapi::WakeConditionVariable(&m_cond);
+    }
+};
 
 //! Blocks in the wait operation until notified
 inline void wait_state::wait(lock_state& state) noexcept
@@ -910,6 +1605,13 @@ inline bool wait_state::wait_for(lock_state& state, std::chrono::nanoseconds rel
 
 #endif
 
+//! Wakes up all wait_any operations attached to the wait state
+inline void wait_state_base::notify_wait_any() noexcept
+{
+    for (wait_any_link* link = m_wait_any_links; link != nullptr; link = link->m_next)
+        link->m_token->notify();
+}
+
 enum
 {
     tail_size = sizeof(lock_state) % BOOST_ATOMIC_CACHE_LINE_SIZE,
@@ -932,51 +1634,399 @@ struct BOOST_ALIGNMENT(BOOST_ATOMIC_CACHE_LINE_SIZE) padded_lock_state< 0u >
 
 using padded_lock_state_t = padded_lock_state< padding_size >;
 
-#if !defined(BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2)
-#define BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 8
-#endif
+#if defined(BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2)
 #if (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2) < 0
 #error "Boost.Atomic: BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 macro value is negative"
+#elif (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2) > 16
+#error "Boost.Atomic: BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 macro value is too large"
 #endif
-#define BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE (1ull << (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2))
+#endif // defined(BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2)
 
-//! Lock pool size. Must be a power of two.
-constexpr std::size_t lock_pool_size = static_cast< std::size_t >(1u) << (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2);
+//! Maximum lock pool size
+constexpr std::size_t max_lock_pool_size = static_cast< std::size_t >(1u) << 16u;
+//! Number of locks per hardware thread in the default lock pool size
+constexpr std::size_t locks_per_hardware_thread = 4u;
+//! Lock pool size that is used if the number of hardware threads cannot be determined. Also the minimum default lock pool size.
+constexpr std::size_t fallback_lock_pool_size = 256u;
 
-static padded_lock_state_t g_lock_pool[lock_pool_size] =
+using lock_pool_ptr_operations = atomics::detail::core_operations< sizeof(atomics::detail::uintptr_t), false, false >;
+static_assert(lock_pool_ptr_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for pointers");
+static_assert(once_flag_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for bytes");
+
+//! Lock pool. Must be a POD structure.
+struct lock_pool_data
 {
-#if BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE > 256u
-#if (BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE / 256u) > BOOST_PP_LIMIT_ITERATION
-#error "Boost.Atomic: BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2 macro value is too large"
+    //! Pointer to the array of lock pool entries, converted to an integer. Zero if the lock pool is not initialized yet.
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(lock_pool_ptr_operations::storage_alignment, lock_pool_ptr_operations::storage_type, m_locks);
+    //! Lock pool size minus one. Since the lock pool size is a power of two, this is the mask for lock indices.
+    std::size_t m_index_mask;
+    //! The flag is set when a thread starts initializing the lock pool
+    once_flag m_init_started;
+};
+
+//! The lock pool. The pool is allocated on the first use and is never deallocated, as atomic objects may be used during process termination.
+static lock_pool_data g_lock_pool = {};
+
+//! The lock pool entry that is used if the lock pool allocation fails
+static padded_lock_state_t g_fallback_lock_pool[1u] = { { BOOST_ATOMIC_LOCK_STATE_INIT } };
+
+static once_flag g_pool_cleanup_registered = {};
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
+
+//! Number of proxy futexes. Must be a power of two.
+constexpr std::size_t futex_proxy_count = 256u;
+//! Max number of pause instructions between attempts to acquire the proxy futex registration lock before yielding
+constexpr unsigned int futex_proxy_lock_max_backoff = 64u;
+
+//! Proxy futex, padded to avoid false sharing between the table entries
+struct BOOST_ALIGNMENT(BOOST_ATOMIC_CACHE_LINE_SIZE) padded_futex_proxy
+{
+    futex_proxy proxy;
+};
+
+//! The table of proxy futexes used by waiting and notifying operations on atomic objects of sizes not supported by futexes
+static padded_futex_proxy g_futex_proxies[futex_proxy_count] = {};
+
+using futex_proxy_operations = core_operations< 4u, false, false >;
+
+//! Locks the proxy futex registration lock, with exponential backoff
+inline void lock_futex_proxy(futex_proxy* proxy) noexcept
+{
+    unsigned int backoff = 1u;
+    while (futex_proxy_operations::exchange(proxy->m_lock, 1u, memory_order_acquire) != 0u)
+    {
+        do
+        {
+            if (BOOST_LIKELY(backoff < futex_proxy_lock_max_backoff))
+            {
+                for (unsigned int i = 0u; i < backoff; ++i)
+                    atomics::thread_pause();
+                backoff *= 2u;
+            }
+            else
+            {
+                atomics::detail::wait_some(); // the lock owner is likely preempted, let it run
+            }
+        }
+        while (futex_proxy_operations::load(proxy->m_lock, memory_order_relaxed) != 0u);
+    }
+}
+
+//! Unlocks the proxy futex registration lock
+inline void unlock_futex_proxy(futex_proxy* proxy) noexcept
+{
+    futex_proxy_operations::store(proxy->m_lock, 0u, memory_order_release);
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
+
+#if !defined(BOOST_ATOMIC_USE_WINAPI) && BOOST_ATOMIC_INT32_LOCK_FREE == 2 && \
+    (defined(BOOST_ATOMIC_USE_FUTEX) || (defined(_POSIX_THREAD_PROCESS_SHARED) && (_POSIX_THREAD_PROCESS_SHARED >= 0)))
+#define BOOST_ATOMIC_HAS_IPC_WAIT_TABLE
+#endif
+
+#if defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+//! The value of the IPC wait table header magic field that indicates that the table is initialized
+constexpr std::uint32_t ipc_wait_table_magic = 0x42415754u;
+//! Max binary logarithm of the number of entries in the IPC wait table
+constexpr std::uint32_t max_ipc_wait_table_size_log2 = 16u;
+
+using ipc_wait_operations = atomics::detail::core_operations< 4u, false, true >;
+
+//! IPC wait table header. Must be a POD structure, as it is placed in shared memory.
+struct ipc_wait_table_header
+{
+    //! Equals to ipc_wait_table_magic when the table is initialized
+    std::uint32_t m_magic;
+    //! Binary logarithm of the number of entries in the table
+    std::uint32_t m_size_log2;
+    //! Size of the shared memory region that starts with the table and contains the atomic objects, in bytes
+    std::uint64_t m_region_size;
+};
+
+//! IPC wait table entry. Must be a POD structure, as it is placed in shared memory.
+struct ipc_wait_entry
+{
+    //! Wake sequence number. Incremented by notifying operations when there are blocked waiting operations.
+    std::uint32_t m_sequence;
+    //! Number of waiting operations that may block on the entry
+    std::uint32_t m_waiter_count;
+#if !defined(BOOST_ATOMIC_USE_FUTEX)
+    //! Process-shared mutex that protects the wake sequence number modification
+    pthread_mutex_t m_mutex;
+    //! Process-shared condition variable that is used to block waiting operations
+    pthread_cond_t m_cond;
+#endif // !defined(BOOST_ATOMIC_USE_FUTEX)
+};
+
+#if !defined(BOOST_ATOMIC_USE_FUTEX)
+//! Clock used by the process-shared condition variables
+#if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK > 0)
+constexpr clockid_t ipc_wait_clock_id = CLOCK_MONOTONIC;
+#else
+constexpr clockid_t ipc_wait_clock_id = CLOCK_REALTIME;
 #endif
-#define BOOST_PP_ITERATION_PARAMS_1 (3, (1, (BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE / 256u), "lock_pool_init256.ipp"))
-#else // BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE > 256u
-#define BOOST_PP_ITERATION_PARAMS_1 (3, (1, BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE, "lock_pool_init1.ipp"))
-#endif // BOOST_ATOMIC_DETAIL_LOCK_POOL_SIZE > 256u
-#include BOOST_PP_ITERATE()
-#undef BOOST_PP_ITERATION_PARAMS_1
+#endif // !defined(BOOST_ATOMIC_USE_FUTEX)
+
+//! Size of the IPC wait table header, in bytes. The header is padded to avoid false sharing with the table entries.
+constexpr std::size_t ipc_wait_table_header_size = BOOST_ATOMIC_CACHE_LINE_SIZE;
+//! Size of an IPC wait table entry, in bytes. The entries are padded to avoid false sharing.
+constexpr std::size_t ipc_wait_entry_stride = (sizeof(ipc_wait_entry) + BOOST_ATOMIC_CACHE_LINE_SIZE - 1u) & ~static_cast< std::size_t >(BOOST_ATOMIC_CACHE_LINE_SIZE - 1u);
+//! Required alignment of the IPC wait table, in bytes
+constexpr std::size_t ipc_wait_table_alignment = atomics::detail::alignment_of< ipc_wait_entry >::value;
+
+//! The IPC wait table attached in the current process, converted to an integer. Zero if no table is attached.
+static lock_pool_ptr_operations::storage_type g_ipc_wait_table = 0u;
+
+//! Returns the attached IPC wait table or \c nullptr if no table is attached
+inline ipc_wait_table_header* get_ipc_wait_table() noexcept
+{
+    return reinterpret_cast< ipc_wait_table_header* >(lock_pool_ptr_operations::load(g_ipc_wait_table, boost::memory_order_acquire));
+}
+
+//! Returns the IPC wait table entry with the given index
+inline ipc_wait_entry* get_ipc_wait_entry_at(ipc_wait_table_header* table, std::size_t index) noexcept
+{
+    return reinterpret_cast< ipc_wait_entry* >(reinterpret_cast< unsigned char* >(table) + ipc_wait_table_header_size + index * ipc_wait_entry_stride);
+}
+
+//! Returns the IPC wait table entry associated with the atomic object or \c nullptr if the object is outside the shared memory region of the table
+inline ipc_wait_entry* find_ipc_wait_entry(ipc_wait_table_header* table, const volatile void* addr) noexcept
+{
+    // The atomic object address is different in different processes, but its offset relative to the table is the same,
+    // as long as the atomic object is located in the same shared memory mapping as the table. Objects below the table
+    // produce a wrapped around offset, which is also rejected by the check.
+    const atomics::detail::uintptr_t offset = reinterpret_cast< atomics::detail::uintptr_t >(addr) - reinterpret_cast< atomics::detail::uintptr_t >(table);
+    if (BOOST_UNLIKELY(static_cast< std::uint64_t >(offset) >= table->m_region_size))
+        return nullptr;
+
+    const std::uint32_t size_log2 = table->m_size_log2;
+    std::size_t index = 0u;
+    if (BOOST_LIKELY(size_log2 > 0u))
+    {
+        // Fibonacci hashing
+        index = static_cast< std::size_t >((static_cast< std::uint64_t >(offset) * UINT64_C(0x9E3779B97F4A7C15)) >> (64u - size_log2));
+    }
+
+    return get_ipc_wait_entry_at(table, index);
+}
+
+#endif // defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+//! Offset of the free list link in a memory block for a wait state, in bytes
+constexpr std::size_t wait_state_block_link_offset = (sizeof(wait_state) + lock_pool_ptr_operations::storage_alignment - 1u) &
+    ~static_cast< std::size_t >(lock_pool_ptr_operations::storage_alignment - 1u);
+//! Size of a memory block for a wait state, in bytes
+constexpr std::size_t wait_state_block_size = wait_state_block_link_offset + sizeof(lock_pool_ptr_operations::storage_type);
+//! Alignment of a memory block for a wait state, in bytes
+constexpr std::size_t wait_state_block_alignment = atomics::detail::alignment_of< wait_state >::value > lock_pool_ptr_operations::storage_alignment ?
+    atomics::detail::alignment_of< wait_state >::value : lock_pool_ptr_operations::storage_alignment;
+
+/*!
+ * \brief List of free memory blocks for wait states. Must be a POD structure.
+ *
+ * The list contains memory blocks that were reserved in advance, so that the lock pool does not need to allocate memory for wait states
+ * while the lock pool entries are locked. Each block starts with the storage for a wait state object, followed by the link to the next block
+ * in the list. Blocks are only pushed to the list when they are allocated and are never returned to the list after being taken from it.
+ * Wait states are instead retained in the wait state lists of the lock pool entries for reuse. This makes the list immune to the ABA problem.
+ */
+struct wait_state_block_list
+{
+    //! Pointer to the first free block, converted to an integer. Zero if the list is empty.
+    BOOST_ATOMIC_DETAIL_ALIGNED_VAR(lock_pool_ptr_operations::storage_alignment, lock_pool_ptr_operations::storage_type, m_head);
+
+    //! Returns a reference to the link to the next block in the list
+    static lock_pool_ptr_operations::storage_type& get_link(lock_pool_ptr_operations::storage_type block) noexcept
+    {
+        return *reinterpret_cast< lock_pool_ptr_operations::storage_type* >(reinterpret_cast< unsigned char* >(block) + wait_state_block_link_offset);
+    }
+
+    //! Adds a newly allocated block to the list
+    void push(void* p) noexcept
+    {
+        const lock_pool_ptr_operations::storage_type block = reinterpret_cast< lock_pool_ptr_operations::storage_type >(p);
+        lock_pool_ptr_operations::storage_type head = lock_pool_ptr_operations::load(m_head, boost::memory_order_relaxed);
+        do
+        {
+            lock_pool_ptr_operations::store(get_link(block), head, boost::memory_order_relaxed);
+        }
+        while (!lock_pool_ptr_operations::compare_exchange_weak(m_head, head, block, boost::memory_order_release, boost::memory_order_relaxed));
+    }
+
+    //! Takes a block from the list. Returns \c nullptr if the list is empty.
+    void* pop() noexcept
+    {
+        lock_pool_ptr_operations::storage_type head = lock_pool_ptr_operations::load(m_head, boost::memory_order_acquire);
+        while (head != 0u)
+        {
+            const lock_pool_ptr_operations::storage_type next = lock_pool_ptr_operations::load(get_link(head), boost::memory_order_relaxed);
+            if (lock_pool_ptr_operations::compare_exchange_weak(m_head, head, next, boost::memory_order_acquire, boost::memory_order_acquire))
+                break;
+        }
+
+        return reinterpret_cast< void* >(head);
+    }
+
+    //! Deallocates all blocks in the list
+    void clear() noexcept
+    {
+        lock_pool_ptr_operations::storage_type block = lock_pool_ptr_operations::exchange(m_head, 0u, boost::memory_order_acquire);
+        while (block != 0u)
+        {
+            const lock_pool_ptr_operations::storage_type next = lock_pool_ptr_operations::load(get_link(block), boost::memory_order_relaxed);
+            boost::alignment::aligned_free(reinterpret_cast< void* >(block));
+            block = next;
+        }
+    }
 };
 
+//! Reserved memory blocks for wait states
+static wait_state_block_list g_free_wait_state_blocks = {};
+
+//! Allocates a memory block for a wait state. Returns \c nullptr in case of failure.
+inline void* allocate_wait_state_block() noexcept
+{
+    void* p = g_free_wait_state_blocks.pop();
+    if (BOOST_LIKELY(p != nullptr))
+        return p;
+
+    return boost::alignment::aligned_alloc(wait_state_block_alignment, wait_state_block_size);
+}
+
+//! Deallocates a memory block for a wait state
+inline void free_wait_state_block(void* p) noexcept
+{
+    boost::alignment::aligned_free(p);
+}
+
+//! Rounds the lock pool size up to a power of two and limits it to the supported range
+std::size_t normalize_lock_pool_size(std::size_t size) noexcept
+{
+    if (size > max_lock_pool_size)
+        return max_lock_pool_size;
+
+    std::size_t pow2_size = 1u;
+    while (pow2_size < size)
+        pow2_size <<= 1u;
+
+    return pow2_size;
+}
+
+//! Returns the lock pool size to use, unless the application specified one
+std::size_t get_default_lock_pool_size() noexcept
+{
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable: 4996) // 'getenv': This function or variable may be unsafe.
+#endif
+    const char* env_size = std::getenv("BOOST_ATOMIC_LOCK_POOL_SIZE");
+#if defined(BOOST_MSVC)
+#pragma warning(pop)
+#endif
+    if (env_size != nullptr)
+    {
+        char* end = nullptr;
+        const unsigned long long size = std::strtoull(env_size, &end, 10);
+        if (end != env_size && *end == '\0' && size > 0u)
+            return normalize_lock_pool_size(size < max_lock_pool_size ? static_cast< std::size_t >(size) : max_lock_pool_size);
+    }
+
+#if defined(BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2)
+    return static_cast< std::size_t >(1u) << (BOOST_ATOMIC_LOCK_POOL_SIZE_LOG2);
+#else
+    const std::size_t hardware_threads = std::thread::hardware_concurrency();
+    if (hardware_threads == 0u)
+        return fallback_lock_pool_size;
+
+    // The lock pool is shared by all lock-based atomics and waiting operations in the process, so don't make it smaller
+    // than the fallback size on hosts with few hardware threads. Only the application can select a smaller pool explicitly.
+    const std::size_t size = hardware_threads * locks_per_hardware_thread;
+    return normalize_lock_pool_size(size > fallback_lock_pool_size ? size : fallback_lock_pool_size);
+#endif
+}
+
+//! Initializes the lock pool with the given size. Returns \c true if the pool was initialized by this call or \c false if it is or was being initialized by another call.
+bool init_lock_pool(std::size_t size) noexcept
+{
+    if (once_flag_operations::exchange(g_lock_pool.m_init_started.m_flag, 1u, boost::memory_order_relaxed) != 0u)
+    {
+        // Wait for the concurrent initialization to complete. This should not take long.
+        while (lock_pool_ptr_operations::load(g_lock_pool.m_locks, boost::memory_order_acquire) == 0u)
+            atomics::detail::wait_some();
+
+        return false;
+    }
+
+    padded_lock_state_t* locks = static_cast< padded_lock_state_t* >(boost::alignment::aligned_alloc(BOOST_ATOMIC_CACHE_LINE_SIZE, size * sizeof(padded_lock_state_t)));
+    if (BOOST_LIKELY(locks != nullptr))
+    {
+        const lock_state init_state = BOOST_ATOMIC_LOCK_STATE_INIT;
+        for (std::size_t i = 0u; i < size; ++i)
+        {
+            padded_lock_state_t* p = new (locks + i) padded_lock_state_t;
+            p->state = init_state;
+        }
+    }
+    else
+    {
+        locks = g_fallback_lock_pool;
+        size = sizeof(g_fallback_lock_pool) / sizeof(*g_fallback_lock_pool);
+    }
+
+    g_lock_pool.m_index_mask = size - 1u;
+    lock_pool_ptr_operations::store(g_lock_pool.m_locks, reinterpret_cast< atomics::detail::uintptr_t >(locks), boost::memory_order_release);
+
+    return true;
+}
+
+//! Returns the array of lock pool entries, initializing the lock pool if needed
+BOOST_FORCEINLINE padded_lock_state_t* get_lock_pool() noexcept
+{
+    atomics::detail::uintptr_t locks = lock_pool_ptr_operations::load(g_lock_pool.m_locks, boost::memory_order_acquire);
+    if (BOOST_UNLIKELY(locks == 0u))
+    {
+        init_lock_pool(get_default_lock_pool_size());
+        locks = lock_pool_ptr_operations::load(g_lock_pool.m_locks, boost::memory_order_acquire);
+    }
+
+    return reinterpret_cast< padded_lock_state_t* >(locks);
+}
+
+//! Returns the lock pool entry for the given pointer hash value
+BOOST_FORCEINLINE lock_state& get_lock_state(atomics::detail::uintptr_t h) noexcept
+{
+    padded_lock_state_t* locks = get_lock_pool();
+    return locks[h & g_lock_pool.m_index_mask].state;
+}
+
 //! Pool cleanup function
 void cleanup_lock_pool()
 {
-    for (std::size_t i = 0u; i < lock_pool_size; ++i)
+    padded_lock_state_t* locks = get_lock_pool();
+    for (std::size_t i = 0u, n = g_lock_pool.m_index_mask + 1u; i < n; ++i)
     {
-        lock_state& state = g_lock_pool[i].state;
+        lock_state& state = locks[i].state;
         state.long_lock();
         state.m_wait_states.m_free_memory = true;
         state.m_wait_states.free_spare();
         state.unlock();
     }
+
+    g_free_wait_state_blocks.clear();
 }
 
-static_assert(once_flag_operations::is_always_lock_free, "Boost.Atomic unsupported target platform: native atomic operations not implemented for bytes");
-static once_flag g_pool_cleanup_registered = {};
+//! Number of attempts to optimistically load an atomic value before falling back to locking
+constexpr unsigned int optimistic_load_attempts = 16u;
+//! Max number of atomic objects in a wait_any operation for which the links to wait states are allocated on the stack
+constexpr std::size_t max_local_wait_any_links = 16u;
 
-//! Returns index of the lock pool entry for the given pointer value
-BOOST_FORCEINLINE std::size_t get_lock_index(atomics::detail::uintptr_t h) noexcept
+//! Returns the pointer to the atomic object associated with the wait state
+inline const volatile void* wait_state_list::get_address(wait_state const* w) const noexcept
 {
-    return h & (lock_pool_size - 1u);
+    BOOST_ASSERT(m_header != nullptr && w->m_index < m_header->size);
+    return get_atomic_pointers()[w->m_index];
 }
 
 //! Finds an existing element with the given pointer to the atomic object or allocates a new one
@@ -1011,16 +2061,21 @@ inline wait_state* wait_state_list::find_or_create(const volatile void* addr) no
     wait_state* w = *pw;
     if (BOOST_UNLIKELY(w == nullptr))
     {
-        w = new (std::nothrow) wait_state(index);
-        if (BOOST_UNLIKELY(w == nullptr))
+        void* p = allocate_wait_state_block();
+        if (BOOST_UNLIKELY(p == nullptr))
             return nullptr;
+        w = new (p) wait_state(index);
         *pw = w;
     }
 
     get_atomic_pointers()[index] = addr;
+    if (has_hash_index(m_header->capacity))
+        insert_hash_index(m_header, index);
 
     ++m_header->size;
 
+    BOOST_ATOMIC_DETAIL_TRACEPOINT3(wait_state_create, addr, m_header->size, m_header->capacity);
+
     return w;
 }
 
@@ -1036,11 +2091,19 @@ inline void wait_state_list::erase(wait_state* w) noexcept
 
     BOOST_ASSERT(index < m_header->size);
     BOOST_ASSERT(pw[index] == w);
+    BOOST_ASSERT(w->m_wait_any_links == nullptr);
 
     std::size_t last_index = m_header->size - 1u;
 
+    const bool has_index = has_hash_index(m_header->capacity);
+    if (has_index)
+        erase_hash_index(m_header, index);
+
     if (index != last_index)
     {
+        if (has_index)
+            get_hash_index(m_header)[find_hash_index_position(m_header, last_index)] = index + 1u;
+
         pa[index] = pa[last_index];
         pa[last_index] = nullptr;
 
@@ -1062,6 +2125,27 @@ inline void wait_state_list::erase(wait_state* w) noexcept
         free_spare();
 }
 
+//! Makes sure the list buffer has capacity for at least the given number of elements
+inline bool wait_state_list::reserve(std::size_t capacity) noexcept
+{
+    // The capacity must be a power of two for the hash index
+    std::size_t new_capacity = m_header != nullptr ? m_header->capacity : initial_capacity;
+    while (new_capacity < capacity)
+        new_capacity *= 2u;
+
+    if (m_header == nullptr || new_capacity > m_header->capacity)
+    {
+        header* new_header = allocate_buffer(new_capacity, m_header);
+        if (BOOST_UNLIKELY(new_header == nullptr))
+            return false;
+        if (m_header != nullptr)
+            boost::alignment::aligned_free(static_cast< void* >(m_header));
+        m_header = new_header;
+    }
+
+    return true;
+}
+
 //! Allocates new buffer for the list entries
 wait_state_list::header* wait_state_list::allocate_buffer(std::size_t new_capacity, header* old_header) noexcept
 {
@@ -1071,7 +2155,7 @@ wait_state_list::header* wait_state_list::allocate_buffer(std::size_t new_capaci
             std::atexit(&cleanup_lock_pool);
     }
 
-    const std::size_t new_buffer_size = entries_offset + new_capacity * sizeof(void*) * 2u;
+    const std::size_t new_buffer_size = get_buffer_size(new_capacity);
 
     void* p = boost::alignment::aligned_alloc(buffer_alignment, new_buffer_size);
     if (BOOST_UNLIKELY(p == nullptr))
@@ -1094,14 +2178,22 @@ wait_state_list::header* wait_state_list::allocate_buffer(std::size_t new_capaci
         wait_state** old_w = get_wait_states(old_a, old_header->capacity);
         std::memcpy(w, old_w, old_header->capacity * sizeof(wait_state*)); // copy spare wait state pointers
         std::memset(w + old_header->capacity, 0, (new_capacity - old_header->capacity) * sizeof(wait_state*));
+
+        h->capacity = new_capacity;
+
+        if (has_hash_index(new_capacity))
+        {
+            std::memset(get_hash_index(h), 0, new_capacity * 2u * sizeof(std::size_t));
+            for (std::size_t i = 0u, n = h->size; i < n; ++i)
+                insert_hash_index(h, i);
+        }
     }
     else
     {
         std::memset(p, 0, new_buffer_size);
+        h->capacity = new_capacity;
     }
 
-    h->capacity = new_capacity;
-
     return h;
 }
 
@@ -1117,7 +2209,8 @@ void wait_state_list::free_spare() noexcept
             if (!w)
                 break;
 
-            delete w;
+            w->~wait_state();
+            free_wait_state_block(w);
             ws[i] = nullptr;
         }
 
@@ -1134,14 +2227,19 @@ void wait_state_list::free_spare() noexcept
 
 BOOST_ATOMIC_DECL void* short_lock(atomics::detail::uintptr_t h) noexcept
 {
-    lock_state& ls = g_lock_pool[get_lock_index(h)].state;
+    lock_state& ls = get_lock_state(h);
     ls.short_lock();
     return &ls;
 }
 
+BOOST_ATOMIC_DECL void short_unlock(void* vls) noexcept
+{
+    static_cast< lock_state* >(vls)->short_unlock();
+}
+
 BOOST_ATOMIC_DECL void* long_lock(atomics::detail::uintptr_t h) noexcept
 {
-    lock_state& ls = g_lock_pool[get_lock_index(h)].state;
+    lock_state& ls = get_lock_state(h);
     ls.long_lock();
     return &ls;
 }
@@ -1151,6 +2249,39 @@ BOOST_ATOMIC_DECL void unlock(void* vls) noexcept
     static_cast< lock_state* >(vls)->unlock();
 }
 
+BOOST_ATOMIC_DECL void load(atomics::detail::uintptr_t h, const volatile void* addr, void* value, std::size_t size, memory_order order) noexcept
+{
+    lock_state& ls = get_lock_state(h);
+
+#if defined(BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE)
+    // Since we don't lock the mutex, a seq_cst load would not be ordered against prior stores to other atomic objects otherwise
+    if (order == boost::memory_order_seq_cst)
+        atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+
+    for (unsigned int i = 0u; i < optimistic_load_attempts; ++i)
+    {
+        const sequence_operations::storage_type seq = sequence_operations::load(ls.m_short_lock.m_sequence, boost::memory_order_acquire);
+        if (BOOST_LIKELY((seq & 1u) == 0u))
+        {
+            // Note: This read may race with a writer holding the short lock. The value is discarded if the sequence counter changes in the meantime.
+            std::memcpy(value, const_cast< const void* >(addr), size);
+            atomics::detail::fence_operations::thread_fence(boost::memory_order_acquire);
+            if (BOOST_LIKELY(sequence_operations::load(ls.m_short_lock.m_sequence, boost::memory_order_relaxed) == seq))
+                return;
+        }
+
+        atomics::thread_pause();
+    }
+#else
+    (void)order;
+#endif // defined(BOOST_ATOMIC_USE_NATIVE_THREAD_FENCE)
+
+    // Guarantee progress in presence of a continuous stream of writers
+    ls.short_lock();
+    std::memcpy(value, const_cast< const void* >(addr), size);
+    ls.short_unlock();
+}
+
 
 BOOST_ATOMIC_DECL void* allocate_wait_state(void* vls, const volatile void* addr) noexcept
 {
@@ -1164,7 +2295,13 @@ BOOST_ATOMIC_DECL void* allocate_wait_state(void* vls, const volatile void* addr
     wait_state* ws = ls->m_wait_states.find_or_create(addr);
 
     if (BOOST_LIKELY(ws != nullptr))
+    {
         ++ws->m_ref_count;
+        ls->m_wait_states.add_waiter();
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        ls->m_stats.record_waiter_count(static_cast< std::size_t >(waiter_count_operations::load(ls->m_wait_states.m_waiter_count, boost::memory_order_relaxed)));
+#endif
+    }
 
     return ws;
 }
@@ -1176,11 +2313,10 @@ BOOST_ATOMIC_DECL void free_wait_state(void* vls, void* vws) noexcept
     wait_state* ws = static_cast< wait_state* >(vws);
     if (BOOST_LIKELY(ws != nullptr))
     {
+        lock_state* ls = static_cast< lock_state* >(vls);
+        ls->m_wait_states.remove_waiter();
         if (--ws->m_ref_count == 0u)
-        {
-            lock_state* ls = static_cast< lock_state* >(vls);
             ls->m_wait_states.erase(ws);
-        }
     }
 }
 
@@ -1192,7 +2328,12 @@ BOOST_ATOMIC_DECL void wait(void* vls, void* vws) noexcept
     wait_state* ws = static_cast< wait_state* >(vws);
     if (BOOST_LIKELY(ws != nullptr))
     {
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(wait_start, ls->m_wait_states.get_address(ws));
         ws->wait(*ls);
+        BOOST_ATOMIC_DETAIL_TRACEPOINT2(wait_done, ls->m_wait_states.get_address(ws), false);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        ls->m_stats.record_blocked_wait();
+#endif
     }
     else
     {
@@ -1212,7 +2353,13 @@ BOOST_ATOMIC_DECL bool wait_until(void* vls, void* vws, clockid_t clock_id, time
     wait_state* ws = static_cast< wait_state* >(vws);
     if (BOOST_LIKELY(ws != nullptr))
     {
-        return ws->wait_until(*ls, clock_id, abs_timeout);
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(wait_start, ls->m_wait_states.get_address(ws));
+        const bool timed_out = ws->wait_until(*ls, clock_id, abs_timeout);
+        BOOST_ATOMIC_DETAIL_TRACEPOINT2(wait_done, ls->m_wait_states.get_address(ws), timed_out);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        ls->m_stats.record_blocked_wait();
+#endif
+        return timed_out;
     }
     else
     {
@@ -1236,7 +2383,13 @@ BOOST_ATOMIC_DECL bool wait_for(void* vls, void* vws, std::chrono::nanoseconds r
     wait_state* ws = static_cast< wait_state* >(vws);
     if (BOOST_LIKELY(ws != nullptr))
     {
-        return ws->wait_for(*ls, rel_timeout);
+        BOOST_ATOMIC_DETAIL_TRACEPOINT1(wait_start, ls->m_wait_states.get_address(ws));
+        const bool timed_out = ws->wait_for(*ls, rel_timeout);
+        BOOST_ATOMIC_DETAIL_TRACEPOINT2(wait_done, ls->m_wait_states.get_address(ws), timed_out);
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+        ls->m_stats.record_blocked_wait();
+#endif
+        return timed_out;
     }
     else
     {
@@ -1249,26 +2402,375 @@ BOOST_ATOMIC_DECL bool wait_for(void* vls, void* vws, std::chrono::nanoseconds r
     }
 }
 
-BOOST_ATOMIC_DECL void notify_one(void* vls, const volatile void* addr) noexcept
+BOOST_ATOMIC_DECL void notify_one(atomics::detail::uintptr_t h, const volatile void* addr) noexcept
 {
-    BOOST_ASSERT(vls != nullptr);
+    lock_state& ls = get_lock_state(h);
+    // Avoid locking the lock pool entry if no thread is waiting on any of the atomic objects associated with it
+    if (ls.m_wait_states.has_waiters())
+    {
+        ls.long_lock();
+        wait_state* ws = ls.m_wait_states.find(addr);
+        if (BOOST_LIKELY(ws != nullptr))
+        {
+            BOOST_ATOMIC_DETAIL_TRACEPOINT1(notify_one, addr);
+            ws->notify_one(ls);
+            ws->notify_wait_any();
+        }
+        ls.unlock();
+    }
+}
 
-    lock_state* ls = static_cast< lock_state* >(vls);
-    wait_state* ws = ls->m_wait_states.find(addr);
-    if (BOOST_LIKELY(ws != nullptr))
-        ws->notify_one(*ls);
+BOOST_ATOMIC_DECL void notify_all(atomics::detail::uintptr_t h, const volatile void* addr) noexcept
+{
+    lock_state& ls = get_lock_state(h);
+    // Avoid locking the lock pool entry if no thread is waiting on any of the atomic objects associated with it
+    if (ls.m_wait_states.has_waiters())
+    {
+        ls.long_lock();
+        wait_state* ws = ls.m_wait_states.find(addr);
+        if (BOOST_LIKELY(ws != nullptr))
+        {
+            BOOST_ATOMIC_DETAIL_TRACEPOINT1(notify_all, addr);
+            ws->notify_all(ls);
+            ws->notify_wait_any();
+        }
+        ls.unlock();
+    }
 }
 
-BOOST_ATOMIC_DECL void notify_all(void* vls, const volatile void* addr) noexcept
+BOOST_ATOMIC_DECL std::size_t wait_any(wait_any_entry const* entries, std::size_t count, std::size_t (*find_changed)(void* context), void* context) noexcept
 {
-    BOOST_ASSERT(vls != nullptr);
+    wait_any_link local_links[max_local_wait_any_links];
+    wait_any_link* links = local_links;
+    if (count > max_local_wait_any_links)
+        links = new (std::nothrow) wait_any_link[count];
 
-    lock_state* ls = static_cast< lock_state* >(vls);
-    wait_state* ws = ls->m_wait_states.find(addr);
-    if (BOOST_LIKELY(ws != nullptr))
-        ws->notify_all(*ls);
+    wait_any_token token;
+
+    // If registration fails, e.g. due to memory allocation failure, the operation degrades to polling the atomic objects
+    std::size_t registered_count = 0u;
+    if (BOOST_LIKELY(links != nullptr))
+    {
+        for (; registered_count < count; ++registered_count)
+        {
+            lock_state& ls = get_lock_state(entries[registered_count].hash);
+            ls.long_lock();
+
+            wait_state* ws = ls.m_wait_states.find_or_create(entries[registered_count].addr);
+            if (BOOST_LIKELY(ws != nullptr))
+            {
+                ++ws->m_ref_count;
+                ls.m_wait_states.add_waiter();
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+                ls.m_stats.record_waiter_count(static_cast< std::size_t >(waiter_count_operations::load(ls.m_wait_states.m_waiter_count, boost::memory_order_relaxed)));
+#endif
+
+                wait_any_link* link = links + registered_count;
+                link->m_wait_state = ws;
+                link->m_token = &token;
+                ws->add_wait_any_link(link);
+            }
+
+            ls.unlock();
+
+            if (BOOST_UNLIKELY(ws == nullptr))
+                break;
+        }
+    }
+
+    std::size_t index;
+    while (true)
+    {
+        // Obtain the notification counter before testing the atomic objects so that a notification between the test and blocking is not lost
+        const auto notify_count = token.get_notify_count();
+        index = find_changed(context);
+        if (index < count)
+            break;
+
+        if (BOOST_LIKELY(registered_count == count))
+            token.wait(notify_count);
+        else
+            atomics::detail::wait_some();
+    }
+
+    for (std::size_t i = 0u; i < registered_count; ++i)
+    {
+        lock_state& ls = get_lock_state(entries[i].hash);
+        ls.long_lock();
+
+        wait_any_link* link = links + i;
+        wait_state* ws = link->m_wait_state;
+        ws->remove_wait_any_link(link);
+        ls.m_wait_states.remove_waiter();
+        if (--ws->m_ref_count == 0u)
+            ls.m_wait_states.erase(ws);
+
+        ls.unlock();
+    }
+
+    if (links != local_links)
+        delete[] links;
+
+    return index;
+}
+
+#if defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
+
+BOOST_ATOMIC_DECL futex_proxy* get_futex_proxy(atomics::detail::uintptr_t h) noexcept
+{
+    return &g_futex_proxies[h & (futex_proxy_count - 1u)].proxy;
+}
+
+BOOST_ATOMIC_DECL std::uint32_t register_futex_proxy_waiter(futex_proxy* proxy, const volatile void* addr) noexcept
+{
+    lock_futex_proxy(proxy);
+
+    bool addresses_became_mixed = false;
+    if (futex_proxy_operations::load(proxy->m_waiter_count, memory_order_relaxed) == 0u)
+    {
+        proxy->m_address = addr;
+        proxy->m_mixed_addresses = 0u;
+    }
+    else if (proxy->m_mixed_addresses == 0u && proxy->m_address != addr)
+    {
+        proxy->m_mixed_addresses = 1u;
+        addresses_became_mixed = true;
+    }
+
+    futex_proxy_operations::fetch_add(proxy->m_waiter_count, 1u, memory_order_relaxed);
+    // The futex value must be obtained while the lock is held so that notify_one_futex_proxy
+    // cannot wake this waiter based on the outdated m_address and m_mixed_addresses values
+    const std::uint32_t futex_val = futex_proxy_operations::load(proxy->m_futex, memory_order_relaxed);
+
+    unlock_futex_proxy(proxy);
+
+    if (BOOST_UNLIKELY(addresses_became_mixed))
+    {
+        // notify_one_futex_proxy may have decided to wake a single waiter before the addresses became mixed, but not woken it yet.
+        // Its futex_signal may wake this waiter instead of the intended one, so wake all waiters that are already blocked.
+        // They will block again if the atomic objects they wait on did not change.
+        atomics::detail::futex_broadcast(&proxy->m_futex, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+    }
+
+    // Pairs with the fence in the notifying operations. Either the notifier sees the waiter count increment
+    // or the waiter sees the modified value of the atomic object.
+    atomics::detail::fence_operations::thread_fence(memory_order_seq_cst);
+
+    return futex_val;
+}
+
+BOOST_ATOMIC_DECL void unregister_futex_proxy_waiter(futex_proxy* proxy) noexcept
+{
+    futex_proxy_operations::fetch_sub(proxy->m_waiter_count, 1u, memory_order_relaxed);
+}
+
+BOOST_ATOMIC_DECL void notify_one_futex_proxy(futex_proxy* proxy, const volatile void* addr) noexcept
+{
+    // The futex word is incremented while the lock is held, so that the waiters registered afterwards don't consume the notification.
+    // The waiters are woken up after the lock is released, so that the woken waiters don't contend with this thread on the lock.
+    enum wake_action { wake_none, wake_one, wake_all };
+    wake_action action = wake_none;
+
+    lock_futex_proxy(proxy);
+
+    if (futex_proxy_operations::load(proxy->m_waiter_count, memory_order_relaxed) > 0u)
+    {
+        if (proxy->m_mixed_addresses != 0u)
+        {
+            // The waiters are blocked on different atomic objects, and we cannot tell which of them will be woken up by futex_signal.
+            // Wake all of them, they will block again if the atomic objects they wait on did not change.
+            futex_proxy_operations::fetch_add(proxy->m_futex, 1u, memory_order_release);
+            action = wake_all;
+        }
+        else if (proxy->m_address == addr)
+        {
+            // If a waiter on a different atomic object registers before the waiter is woken up, register_futex_proxy_waiter
+            // wakes all blocked waiters, including the one intended to be woken by this call
+            futex_proxy_operations::fetch_add(proxy->m_futex, 1u, memory_order_release);
+            action = wake_one;
+        }
+    }
+
+    unlock_futex_proxy(proxy);
+
+    if (action == wake_one)
+        atomics::detail::futex_signal(&proxy->m_futex, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+    else if (action == wake_all)
+        atomics::detail::futex_broadcast(&proxy->m_futex, BOOST_ATOMIC_DETAIL_FUTEX_PRIVATE_FLAG);
+}
+
+#endif // defined(BOOST_ATOMIC_DETAIL_HAS_FUTEX)
+
+#if !defined(BOOST_WINDOWS)
+
+#if defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+BOOST_ATOMIC_DECL void* get_ipc_wait_entry(const volatile void* addr) noexcept
+{
+    ipc_wait_table_header* table = get_ipc_wait_table();
+    if (BOOST_UNLIKELY(table == nullptr))
+        return nullptr;
+
+    return find_ipc_wait_entry(table, addr);
+}
+
+BOOST_ATOMIC_DECL std::uint32_t register_ipc_waiter(void* vent) noexcept
+{
+    BOOST_ASSERT(vent != nullptr);
+
+    ipc_wait_entry* entry = static_cast< ipc_wait_entry* >(vent);
+    ipc_wait_operations::fetch_add(entry->m_waiter_count, 1u, boost::memory_order_relaxed);
+    // Pairs with the fence in ipc_notify. Either the waiting operation observes the new value of the atomic object,
+    // or the notifying operation observes the incremented waiter counter.
+    atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+
+    // Pairs with the increment in ipc_notify. If the waiting operation observes the incremented sequence number,
+    // it also observes the new value of the atomic object.
+    return ipc_wait_operations::load(entry->m_sequence, boost::memory_order_acquire);
+}
+
+BOOST_ATOMIC_DECL void unregister_ipc_waiter(void* vent) noexcept
+{
+    BOOST_ASSERT(vent != nullptr);
+
+    ipc_wait_entry* entry = static_cast< ipc_wait_entry* >(vent);
+    ipc_wait_operations::fetch_sub(entry->m_waiter_count, 1u, boost::memory_order_relaxed);
+}
+
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait(void* vent, std::uint32_t seq) noexcept
+{
+    BOOST_ASSERT(vent != nullptr);
+
+    ipc_wait_entry* entry = static_cast< ipc_wait_entry* >(vent);
+
+#if defined(BOOST_ATOMIC_USE_FUTEX)
+    // The futex is process-shared, so don't use FUTEX_PRIVATE_FLAG
+    atomics::detail::futex_wait(&entry->m_sequence, seq, 0);
+    return ipc_wait_operations::load(entry->m_sequence, boost::memory_order_acquire);
+#else // defined(BOOST_ATOMIC_USE_FUTEX)
+    BOOST_VERIFY(pthread_mutex_lock(&entry->m_mutex) == 0);
+    if (ipc_wait_operations::load(entry->m_sequence, boost::memory_order_relaxed) == seq)
+        pthread_cond_wait(&entry->m_cond, &entry->m_mutex);
+    seq = ipc_wait_operations::load(entry->m_sequence, boost::memory_order_relaxed);
+    BOOST_VERIFY(pthread_mutex_unlock(&entry->m_mutex) == 0);
+    return seq;
+#endif // defined(BOOST_ATOMIC_USE_FUTEX)
+}
+
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait_for(void* vent, std::uint32_t seq, std::chrono::nanoseconds rel_timeout) noexcept
+{
+    BOOST_ASSERT(vent != nullptr);
+
+    ipc_wait_entry* entry = static_cast< ipc_wait_entry* >(vent);
+
+#if defined(BOOST_ATOMIC_USE_FUTEX)
+    futex_timespec ts{};
+
+    const std::chrono::nanoseconds::rep sec = rel_timeout.count() / 1000000000;
+    if (BOOST_LIKELY(sec <= (std::numeric_limits< decltype(ts.tv_sec) >::max)()))
+    {
+        ts.tv_sec = static_cast< decltype(ts.tv_sec) >(sec);
+        ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(rel_timeout.count() % 1000000000);
+    }
+    else
+    {
+        ts.tv_sec = (std::numeric_limits< decltype(ts.tv_sec) >::max)();
+        ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(999999999);
+    }
+
+    atomics::detail::futex_wait_for(&entry->m_sequence, seq, ts, 0);
+    return ipc_wait_operations::load(entry->m_sequence, boost::memory_order_acquire);
+#else // defined(BOOST_ATOMIC_USE_FUTEX)
+    timespec ts{};
+    BOOST_VERIFY(clock_gettime(ipc_wait_clock_id, &ts) == 0);
+
+    std::chrono::nanoseconds::rep nsec = rel_timeout.count() + ts.tv_nsec;
+    std::chrono::nanoseconds::rep sec = static_cast< std::chrono::nanoseconds::rep >(ts.tv_sec) + nsec / 1000000000;
+    if (BOOST_LIKELY(sec <= (std::numeric_limits< decltype(ts.tv_sec) >::max)()))
+    {
+        ts.tv_sec = static_cast< decltype(ts.tv_sec) >(sec);
+        ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(nsec % 1000000000);
+    }
+    else
+    {
+        ts.tv_sec = (std::numeric_limits< decltype(ts.tv_sec) >::max)();
+        ts.tv_nsec = static_cast< decltype(ts.tv_nsec) >(999999999);
+    }
+
+    BOOST_VERIFY(pthread_mutex_lock(&entry->m_mutex) == 0);
+    if (ipc_wait_operations::load(entry->m_sequence, boost::memory_order_relaxed) == seq)
+        pthread_cond_timedwait(&entry->m_cond, &entry->m_mutex, &ts);
+    seq = ipc_wait_operations::load(entry->m_sequence, boost::memory_order_relaxed);
+    BOOST_VERIFY(pthread_mutex_unlock(&entry->m_mutex) == 0);
+    return seq;
+#endif // defined(BOOST_ATOMIC_USE_FUTEX)
+}
+
+BOOST_ATOMIC_DECL void ipc_notify(const volatile void* addr) noexcept
+{
+    ipc_wait_table_header* table = get_ipc_wait_table();
+    if (BOOST_LIKELY(table == nullptr))
+        return;
+
+    ipc_wait_entry* entry = find_ipc_wait_entry(table, addr);
+    if (BOOST_UNLIKELY(entry == nullptr))
+        return;
+
+    // Pairs with the fence in register_ipc_waiter
+    atomics::detail::fence_operations::thread_fence(boost::memory_order_seq_cst);
+    if (ipc_wait_operations::load(entry->m_waiter_count, boost::memory_order_relaxed) == 0u)
+        return;
+
+    // The entry may be shared by multiple atomic objects, so wake all blocked threads, even for notify_one
+#if defined(BOOST_ATOMIC_USE_FUTEX)
+    ipc_wait_operations::fetch_add(entry->m_sequence, 1u, boost::memory_order_release);
+    atomics::detail::futex_broadcast(&entry->m_sequence, 0);
+#else // defined(BOOST_ATOMIC_USE_FUTEX)
+    BOOST_VERIFY(pthread_mutex_lock(&entry->m_mutex) == 0);
+    ipc_wait_operations::fetch_add(entry->m_sequence, 1u, boost::memory_order_release);
+    BOOST_VERIFY(pthread_cond_broadcast(&entry->m_cond) == 0);
+    BOOST_VERIFY(pthread_mutex_unlock(&entry->m_mutex) == 0);
+#endif // defined(BOOST_ATOMIC_USE_FUTEX)
+}
+
+#else // defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+BOOST_ATOMIC_DECL void* get_ipc_wait_entry(const volatile void*) noexcept
+{
+    return nullptr;
+}
+
+BOOST_ATOMIC_DECL std::uint32_t register_ipc_waiter(void*) noexcept
+{
+    BOOST_ASSERT(false);
+    return 0u;
+}
+
+BOOST_ATOMIC_DECL void unregister_ipc_waiter(void*) noexcept
+{
+    BOOST_ASSERT(false);
+}
+
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait(void*, std::uint32_t seq) noexcept
+{
+    BOOST_ASSERT(false);
+    return seq;
+}
+
+BOOST_ATOMIC_DECL std::uint32_t ipc_wait_for(void*, std::uint32_t seq, std::chrono::nanoseconds) noexcept
+{
+    BOOST_ASSERT(false);
+    return seq;
+}
+
+BOOST_ATOMIC_DECL void ipc_notify(const volatile void*) noexcept
+{
 }
 
+#endif // defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+#endif // !defined(BOOST_WINDOWS)
+
 
 BOOST_ATOMIC_DECL void thread_fence() noexcept
 {
@@ -1276,7 +2778,7 @@ BOOST_ATOMIC_DECL void thread_fence() noexcept
     atomics::detail::fence_operations::thread_fence(memory_order_seq_cst);
 #else
     // Emulate full fence by locking/unlocking a mutex
-    lock_pool::unlock(lock_pool::short_lock(0u));
+    lock_pool::short_unlock(lock_pool::short_lock(0u));
 #endif
 }
 
@@ -1290,6 +2792,262 @@ BOOST_ATOMIC_DECL void signal_fence() noexcept
 
 } // namespace lock_pool
 } // namespace detail
+
+BOOST_ATOMIC_DECL bool set_lock_pool_size(std::size_t size) noexcept
+{
+    size = atomics::detail::lock_pool::normalize_lock_pool_size(size);
+    atomics::detail::lock_pool::init_lock_pool(size);
+    return atomics::get_lock_pool_size() == size;
+}
+
+BOOST_ATOMIC_DECL std::size_t get_lock_pool_size() noexcept
+{
+    atomics::detail::lock_pool::get_lock_pool();
+    return atomics::detail::lock_pool::g_lock_pool.m_index_mask + 1u;
+}
+
+BOOST_ATOMIC_DECL bool reserve_lock_pool_wait_states(std::size_t count) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    if (count == 0u)
+        return true;
+
+    padded_lock_state_t* locks = get_lock_pool();
+    const std::size_t pool_size = g_lock_pool.m_index_mask + 1u;
+    const std::size_t capacity_per_lock = (count + pool_size - 1u) / pool_size;
+
+    bool result = true;
+    for (std::size_t i = 0u; i < pool_size; ++i)
+    {
+        lock_state& state = locks[i].state;
+        state.long_lock();
+        result &= state.m_wait_states.reserve(capacity_per_lock);
+        state.unlock();
+    }
+
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        void* p = boost::alignment::aligned_alloc(wait_state_block_alignment, wait_state_block_size);
+        if (BOOST_UNLIKELY(p == nullptr))
+        {
+            result = false;
+            break;
+        }
+
+        g_free_wait_state_blocks.push(p);
+    }
+
+    return result;
+}
+
+#if defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+
+BOOST_ATOMIC_DECL bool get_lock_pool_statistics(std::size_t index, lock_pool_statistics& stats) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    padded_lock_state_t* locks = get_lock_pool();
+    if (index > g_lock_pool.m_index_mask)
+        return false;
+
+    lock_state& state = locks[index].state;
+    lock_statistics const& ls = state.m_stats;
+
+    // Spin lock counters are modified without locking the mutex
+    stats.short_lock_count = lock_statistics::get(ls.m_short_lock_count);
+    stats.contended_short_lock_count = lock_statistics::get(ls.m_contended_short_lock_count);
+
+    // The wait state list buffer may be reallocated or freed concurrently, so the mutex must be locked
+    state.long_lock();
+
+    stats.lock_count = lock_statistics::get(ls.m_lock_count);
+    stats.contended_lock_count = lock_statistics::get(ls.m_contended_lock_count);
+    stats.spin_lock_count = lock_statistics::get(ls.m_spin_lock_count);
+    stats.blocked_lock_count = lock_statistics::get(ls.m_blocked_lock_count);
+    stats.blocked_wait_count = lock_statistics::get(ls.m_blocked_wait_count);
+    stats.waiter_count = static_cast< std::uint64_t >(waiter_count_operations::load(state.m_wait_states.m_waiter_count, boost::memory_order_relaxed));
+    stats.max_waiter_count = lock_statistics::get(ls.m_max_waiter_count);
+    stats.wait_state_capacity = state.m_wait_states.m_header != nullptr ? static_cast< std::uint64_t >(state.m_wait_states.m_header->capacity) : 0u;
+
+    state.unlock();
+
+    return true;
+}
+
+#else // defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+
+BOOST_ATOMIC_DECL bool get_lock_pool_statistics(std::size_t, lock_pool_statistics&) noexcept
+{
+    return false;
+}
+
+#endif // defined(BOOST_ATOMIC_LOCK_POOL_STATISTICS)
+
+#if defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+BOOST_ATOMIC_DECL std::size_t get_ipc_wait_table_size(std::size_t entry_count) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    std::size_t count = 1u;
+    while (count < entry_count && count < (static_cast< std::size_t >(1u) << max_ipc_wait_table_size_log2))
+        count <<= 1u;
+
+    return ipc_wait_table_header_size + count * ipc_wait_entry_stride;
+}
+
+BOOST_ATOMIC_DECL bool create_ipc_wait_table(void* memory, std::size_t size, std::size_t region_size) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    if (BOOST_UNLIKELY(memory == nullptr || (reinterpret_cast< atomics::detail::uintptr_t >(memory) & (ipc_wait_table_alignment - 1u)) != 0u ||
+        size < (ipc_wait_table_header_size + ipc_wait_entry_stride) || region_size < size))
+    {
+        return false;
+    }
+
+    std::uint32_t size_log2 = 0u;
+    while (size_log2 < max_ipc_wait_table_size_log2 &&
+        (size - ipc_wait_table_header_size) / ipc_wait_entry_stride >= (static_cast< std::size_t >(1u) << (size_log2 + 1u)))
+    {
+        ++size_log2;
+    }
+
+    const std::size_t count = static_cast< std::size_t >(1u) << size_log2;
+    std::memset(memory, 0, ipc_wait_table_header_size + count * ipc_wait_entry_stride);
+
+    ipc_wait_table_header* table = static_cast< ipc_wait_table_header* >(memory);
+    table->m_size_log2 = size_log2;
+    table->m_region_size = static_cast< std::uint64_t >(region_size);
+
+#if !defined(BOOST_ATOMIC_USE_FUTEX)
+    pthread_mutexattr_t mutex_attr;
+    if (BOOST_UNLIKELY(pthread_mutexattr_init(&mutex_attr) != 0))
+        return false;
+    pthread_condattr_t cond_attr;
+    if (BOOST_UNLIKELY(pthread_condattr_init(&cond_attr) != 0))
+    {
+        pthread_mutexattr_destroy(&mutex_attr);
+        return false;
+    }
+
+    bool result = pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED) == 0 &&
+        pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED) == 0;
+#if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK > 0)
+    result = result && pthread_condattr_setclock(&cond_attr, ipc_wait_clock_id) == 0;
+#endif
+
+    std::size_t i = 0u;
+    for (; result && i < count; ++i)
+    {
+        ipc_wait_entry* entry = get_ipc_wait_entry_at(table, i);
+        if (BOOST_UNLIKELY(pthread_mutex_init(&entry->m_mutex, &mutex_attr) != 0))
+        {
+            result = false;
+            break;
+        }
+
+        if (BOOST_UNLIKELY(pthread_cond_init(&entry->m_cond, &cond_attr) != 0))
+        {
+            pthread_mutex_destroy(&entry->m_mutex);
+            result = false;
+            break;
+        }
+    }
+
+    pthread_condattr_destroy(&cond_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+
+    if (BOOST_UNLIKELY(!result))
+    {
+        while (i > 0u)
+        {
+            --i;
+            ipc_wait_entry* entry = get_ipc_wait_entry_at(table, i);
+            pthread_cond_destroy(&entry->m_cond);
+            pthread_mutex_destroy(&entry->m_mutex);
+        }
+
+        return false;
+    }
+#endif // !defined(BOOST_ATOMIC_USE_FUTEX)
+
+    ipc_wait_operations::store(table->m_magic, ipc_wait_table_magic, boost::memory_order_release);
+
+    return true;
+}
+
+BOOST_ATOMIC_DECL void destroy_ipc_wait_table(void* memory) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    ipc_wait_table_header* table = static_cast< ipc_wait_table_header* >(memory);
+    if (BOOST_UNLIKELY(table == nullptr || ipc_wait_operations::load(table->m_magic, boost::memory_order_acquire) != ipc_wait_table_magic))
+        return;
+
+    ipc_wait_operations::store(table->m_magic, 0u, boost::memory_order_relaxed);
+
+#if !defined(BOOST_ATOMIC_USE_FUTEX)
+    const std::size_t count = static_cast< std::size_t >(1u) << table->m_size_log2;
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        ipc_wait_entry* entry = get_ipc_wait_entry_at(table, i);
+        pthread_cond_destroy(&entry->m_cond);
+        pthread_mutex_destroy(&entry->m_mutex);
+    }
+#endif // !defined(BOOST_ATOMIC_USE_FUTEX)
+}
+
+BOOST_ATOMIC_DECL bool attach_ipc_wait_table(void* memory) noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    ipc_wait_table_header* table = static_cast< ipc_wait_table_header* >(memory);
+    if (BOOST_UNLIKELY(table == nullptr || (reinterpret_cast< atomics::detail::uintptr_t >(memory) & (ipc_wait_table_alignment - 1u)) != 0u ||
+        ipc_wait_operations::load(table->m_magic, boost::memory_order_acquire) != ipc_wait_table_magic))
+    {
+        return false;
+    }
+
+    lock_pool_ptr_operations::store(g_ipc_wait_table, reinterpret_cast< lock_pool_ptr_operations::storage_type >(table), boost::memory_order_release);
+    return true;
+}
+
+BOOST_ATOMIC_DECL void detach_ipc_wait_table() noexcept
+{
+    using namespace atomics::detail::lock_pool;
+
+    lock_pool_ptr_operations::store(g_ipc_wait_table, 0u, boost::memory_order_release);
+}
+
+#else // defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
+BOOST_ATOMIC_DECL std::size_t get_ipc_wait_table_size(std::size_t) noexcept
+{
+    return 0u;
+}
+
+BOOST_ATOMIC_DECL bool create_ipc_wait_table(void*, std::size_t, std::size_t) noexcept
+{
+    return false;
+}
+
+BOOST_ATOMIC_DECL void destroy_ipc_wait_table(void*) noexcept
+{
+}
+
+BOOST_ATOMIC_DECL bool attach_ipc_wait_table(void*) noexcept
+{
+    return false;
+}
+
+BOOST_ATOMIC_DECL void detach_ipc_wait_table() noexcept
+{
+}
+
+#endif // defined(BOOST_ATOMIC_HAS_IPC_WAIT_TABLE)
+
 } // namespace atomics
 } // namespace boost
 
@@ -1,13 +0,0 @@
-/*
- * Distributed under the Boost Software License, Version 1.0.
- * (See accompanying file LICENSE_1_0.txt or copy at
- * http://www.boost.org/LICENSE_1_0.txt)
- *
- * Copyright (c) 2020 Andrey Semashev
- */
-
-#if BOOST_PP_ITERATION() > 1
-,
-#endif
-
-{ BOOST_ATOMIC_LOCK_STATE_INIT }
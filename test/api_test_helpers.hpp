@@ -93,7 +93,8 @@ inline typename std::enable_if< is_atomic< T >::value >::type test_atomic_type_t
 template< typename T >
 inline typename std::enable_if< is_atomic_ref< T >::value >::type test_atomic_type_traits(boost::type< T >)
 {
-    if (T::is_always_lock_free)
+    // The lock-free property of 128-bit atomic operations may be detected at run time, which requires the alignment for the lock-free implementation
+    if (T::is_always_lock_free || (sizeof(typename T::value_type) == 16u && BOOST_ATOMIC_INT128_LOCK_FREE == 1))
     {
         BOOST_TEST_GE(T::required_alignment, boost::alignment_of< typename T::value_type >::value);
     }
@@ -224,6 +225,27 @@ void test_base_operators(T value1, T value2, T value3)
         BOOST_TEST_EQ( a.load(), value1 );
         BOOST_TEST_EQ( expected, value1 );
     }
+
+    // generic read-modify-write operations
+    {
+        Wrapper<T> wrapper(value1);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_update([&](T const& v) { BOOST_TEST_EQ( v, value1 ); return value2; });
+        BOOST_TEST_EQ( n, value1 );
+        BOOST_TEST_EQ( a.load(), value2 );
+    }
+
+    {
+        Wrapper<T> wrapper(value1);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        bool success = a.update_if([&](T& v) { BOOST_TEST_EQ( v, value1 ); v = value3; return true; }, boost::memory_order_acq_rel);
+        BOOST_TEST( success );
+        BOOST_TEST_EQ( a.load(), value3 );
+
+        success = a.update_if([&](T& v) { BOOST_TEST_EQ( v, value3 ); v = value2; return false; }, boost::memory_order_release);
+        BOOST_TEST( !success );
+        BOOST_TEST_EQ( a.load(), value3 );
+    }
 }
 
 //! Tests whether boost::atomic supports constexpr constructor. Note that boost::atomic_ref (as std::atomic_ref) does not support constexpr constructor.
@@ -761,6 +783,192 @@ void test_negation()
     }
 }
 
+//! Tests fetch_max/fetch_min operations and their opaque and test variants. \a low must be less than \a high.
+template< template< typename > class Wrapper, typename T >
+void test_min_max_operators(T low, T high)
+{
+    {
+        Wrapper<T> wrapper(low);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_max(high);
+        BOOST_TEST_EQ( n, low );
+        BOOST_TEST_EQ( a.load(), high );
+
+        // No modification if the stored value is already greater
+        n = a.fetch_max(low);
+        BOOST_TEST_EQ( n, high );
+        BOOST_TEST_EQ( a.load(), high );
+
+        n = a.fetch_max(high);
+        BOOST_TEST_EQ( n, high );
+        BOOST_TEST_EQ( a.load(), high );
+    }
+    {
+        Wrapper<T> wrapper(high);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_min(low);
+        BOOST_TEST_EQ( n, high );
+        BOOST_TEST_EQ( a.load(), low );
+
+        n = a.fetch_min(high);
+        BOOST_TEST_EQ( n, low );
+        BOOST_TEST_EQ( a.load(), low );
+    }
+    {
+        Wrapper<T> wrapper(low);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        a.opaque_max(high);
+        BOOST_TEST_EQ( a.load(), high );
+
+        a.opaque_max(low);
+        BOOST_TEST_EQ( a.load(), high );
+
+        a.opaque_min(low);
+        BOOST_TEST_EQ( a.load(), low );
+
+        a.opaque_min(high);
+        BOOST_TEST_EQ( a.load(), low );
+    }
+    {
+        Wrapper<T> wrapper(low);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        bool f = a.max_and_test(high);
+        BOOST_TEST_EQ( f, high != (T)0 );
+        BOOST_TEST_EQ( a.load(), high );
+
+        f = a.min_and_test(low);
+        BOOST_TEST_EQ( f, low != (T)0 );
+        BOOST_TEST_EQ( a.load(), low );
+
+        // The result reflects the stored value, even if it was not modified
+        f = a.min_and_test(high);
+        BOOST_TEST_EQ( f, low != (T)0 );
+        BOOST_TEST_EQ( a.load(), low );
+    }
+}
+
+//! Tests saturating arithmetic operations
+template< template< typename > class Wrapper, typename T >
+void test_saturating_operators()
+{
+    const T min_value = (distance_limits< T, T >::min)();
+    const T max_value = (distance_limits< T, T >::max)();
+
+    {
+        Wrapper<T> wrapper((T)10);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_add_sat((T)5);
+        BOOST_TEST_EQ( n, (T)10 );
+        BOOST_TEST_EQ( a.load(), (T)15 );
+
+        n = a.fetch_sub_sat((T)5);
+        BOOST_TEST_EQ( n, (T)15 );
+        BOOST_TEST_EQ( a.load(), (T)10 );
+    }
+    {
+        Wrapper<T> wrapper((T)(max_value - (T)1));
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_add_sat((T)5);
+        BOOST_TEST_EQ( n, (T)(max_value - (T)1) );
+        BOOST_TEST_EQ( a.load(), max_value );
+
+        n = a.fetch_add_sat((T)5);
+        BOOST_TEST_EQ( n, max_value );
+        BOOST_TEST_EQ( a.load(), max_value );
+    }
+    {
+        Wrapper<T> wrapper((T)(min_value + (T)1));
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_sub_sat((T)5);
+        BOOST_TEST_EQ( n, (T)(min_value + (T)1) );
+        BOOST_TEST_EQ( a.load(), min_value );
+
+        n = a.fetch_sub_sat((T)5);
+        BOOST_TEST_EQ( n, min_value );
+        BOOST_TEST_EQ( a.load(), min_value );
+    }
+    if (boost::is_signed< T >::value)
+    {
+        Wrapper<T> wrapper((T)(min_value + (T)1));
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_add_sat((T)-5);
+        BOOST_TEST_EQ( n, (T)(min_value + (T)1) );
+        BOOST_TEST_EQ( a.load(), min_value );
+
+        a.store((T)(max_value - (T)1));
+        n = a.fetch_sub_sat((T)-5);
+        BOOST_TEST_EQ( n, (T)(max_value - (T)1) );
+        BOOST_TEST_EQ( a.load(), max_value );
+    }
+    {
+        Wrapper<T> wrapper((T)10);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_add_sat((T)5, (T)12);
+        BOOST_TEST_EQ( n, (T)10 );
+        BOOST_TEST_EQ( a.load(), (T)12 );
+
+        n = a.fetch_add_sat((T)5, (T)12);
+        BOOST_TEST_EQ( n, (T)12 );
+        BOOST_TEST_EQ( a.load(), (T)12 );
+
+        // The value is not modified if it is already beyond the limit
+        n = a.fetch_add_sat((T)1, (T)11);
+        BOOST_TEST_EQ( n, (T)12 );
+        BOOST_TEST_EQ( a.load(), (T)12 );
+    }
+    {
+        Wrapper<T> wrapper((T)10);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_sub_sat((T)5, (T)7);
+        BOOST_TEST_EQ( n, (T)10 );
+        BOOST_TEST_EQ( a.load(), (T)7 );
+
+        n = a.fetch_sub_sat((T)5, (T)7);
+        BOOST_TEST_EQ( n, (T)7 );
+        BOOST_TEST_EQ( a.load(), (T)7 );
+
+        n = a.fetch_sub_sat((T)1, (T)8);
+        BOOST_TEST_EQ( n, (T)7 );
+        BOOST_TEST_EQ( a.load(), (T)7 );
+    }
+    {
+        Wrapper<T> wrapper((T)10);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        bool f = a.sub_if_ge((T)4);
+        BOOST_TEST_EQ( f, true );
+        BOOST_TEST_EQ( a.load(), (T)6 );
+
+        f = a.sub_if_ge((T)7);
+        BOOST_TEST_EQ( f, false );
+        BOOST_TEST_EQ( a.load(), (T)6 );
+
+        f = a.sub_if_ge((T)6);
+        BOOST_TEST_EQ( f, true );
+        BOOST_TEST_EQ( a.load(), (T)0 );
+    }
+    if (boost::is_signed< T >::value)
+    {
+        Wrapper<T> wrapper((T)(max_value - (T)1));
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        bool f = a.sub_if_ge((T)-1);
+        BOOST_TEST_EQ( f, true );
+        BOOST_TEST_EQ( a.load(), max_value );
+
+        f = a.sub_if_ge((T)-1);
+        BOOST_TEST_EQ( f, true );
+        BOOST_TEST_EQ( a.load(), max_value );
+
+        a.store((T)-5);
+        f = a.sub_if_ge((T)-3);
+        BOOST_TEST_EQ( f, false );
+        BOOST_TEST_EQ( a.load(), (T)-5 );
+
+        f = a.sub_if_ge((T)-7);
+        BOOST_TEST_EQ( f, true );
+        BOOST_TEST_EQ( a.load(), (T)2 );
+    }
+}
+
 template< template< typename > class Wrapper, typename T >
 void test_additive_wrap(T value)
 {
@@ -1188,6 +1396,10 @@ void do_test_integral_api(std::false_type)
     /* test for signed overflow/underflow */
     test_additive_operators< Wrapper, T, T >(((T)-1) >> (sizeof(T) * 8 - 1), 1);
     test_additive_operators< Wrapper, T, T >(1 + (((T)-1) >> (sizeof(T) * 8 - 1)), 1);
+
+    test_min_max_operators< Wrapper, T >(17, 42);
+    test_min_max_operators< Wrapper, T >(0, 1);
+    test_saturating_operators< Wrapper, T >();
 }
 
 template< template< typename > class Wrapper, typename T >
@@ -1209,7 +1421,10 @@ inline void test_integral_api(void)
     do_test_integral_api< Wrapper, T >(std::integral_constant< bool, boost::is_unsigned< T >::value >());
 
     if (boost::is_signed<T>::value)
+    {
         test_negation< Wrapper, T >();
+        test_min_max_operators< Wrapper, T >((T)-5, (T)3);
+    }
 }
 
 template< template< typename > class Wrapper, typename T >
@@ -1337,6 +1552,45 @@ void test_fp_negation()
     }
 }
 
+template< template< typename > class Wrapper, typename T >
+void test_fp_min_max_operators(T low, T high)
+{
+    {
+        Wrapper<T> wrapper(low);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        T n = a.fetch_max(high);
+        BOOST_TEST_EQ( n, approx(low) );
+        BOOST_TEST_EQ( a.load(), approx(high) );
+
+        n = a.fetch_max(low);
+        BOOST_TEST_EQ( n, approx(high) );
+        BOOST_TEST_EQ( a.load(), approx(high) );
+
+        n = a.fetch_min(low);
+        BOOST_TEST_EQ( n, approx(high) );
+        BOOST_TEST_EQ( a.load(), approx(low) );
+
+        n = a.fetch_min(high);
+        BOOST_TEST_EQ( n, approx(low) );
+        BOOST_TEST_EQ( a.load(), approx(low) );
+    }
+    {
+        Wrapper<T> wrapper(low);
+        typename Wrapper<T>::atomic_reference_type a = wrapper.a;
+        a.opaque_max(high);
+        BOOST_TEST_EQ( a.load(), approx(high) );
+
+        a.opaque_max(low);
+        BOOST_TEST_EQ( a.load(), approx(high) );
+
+        a.opaque_min(low);
+        BOOST_TEST_EQ( a.load(), approx(low) );
+
+        a.opaque_min(high);
+        BOOST_TEST_EQ( a.load(), approx(low) );
+    }
+}
+
 #endif // !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
 
 template< template< typename > class Wrapper, typename T >
@@ -1351,6 +1605,7 @@ void test_floating_point_api(void)
     test_fp_additive_operators< Wrapper, T, T >(static_cast<T>(-42.5), static_cast<T>(-17.7));
 
     test_fp_negation< Wrapper, T >();
+    test_fp_min_max_operators< Wrapper, T >(static_cast<T>(-42.5), static_cast<T>(17.7));
 #endif
 }
 
@@ -1380,6 +1635,7 @@ void test_pointer_api(void)
 
     test_base_operators< Wrapper, T* >(&values[0], &values[1], &values[2]);
     test_additive_operators< Wrapper, T* >(&values[1], 1);
+    test_min_max_operators< Wrapper, T* >(&values[1], &values[3]);
 
     test_base_operators< Wrapper, void* >(&values[0], &values[1], &values[2]);
 
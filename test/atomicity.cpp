@@ -244,6 +244,50 @@ bool test_bitops(boost::atomic< value_type >& shared_value, std::size_t instance
     return true;
 }
 
+//! A structure that is too large to be lock-free on any target
+struct large_struct
+{
+    unsigned int data[64];
+
+    explicit large_struct(unsigned int value = 0u) BOOST_NOEXCEPT_OR_NOTHROW
+    {
+        for (std::size_t i = 0; i < sizeof(data) / sizeof(*data); ++i)
+            data[i] = value;
+    }
+
+    bool is_consistent() const BOOST_NOEXCEPT_OR_NOTHROW
+    {
+        for (std::size_t i = 1; i < sizeof(data) / sizeof(*data); ++i)
+        {
+            if (data[i] != data[0])
+                return false;
+        }
+
+        return true;
+    }
+};
+
+template<typename value_type>
+bool test_load_store(boost::atomic< value_type >& shared_value, std::size_t instance)
+{
+    if (instance == 0)
+    {
+        for (unsigned int n = 0; n < 255; ++n)
+            shared_value.store(value_type(n), boost::memory_order_release);
+    }
+    else
+    {
+        for (std::size_t n = 0; n < 255; ++n)
+        {
+            value_type tmp = shared_value.load(boost::memory_order_acquire);
+            if (!tmp.is_consistent())
+                return false;
+        }
+    }
+
+    return true;
+}
+
 int main(int, char *[])
 {
     double avg_race_time = estimate_avg_race_time();
@@ -281,5 +325,18 @@ int main(int, char *[])
         BOOST_TEST(success); // concurrent bit operations error
     }
 
+    {
+        boost::atomic<large_struct> value(large_struct(0u));
+
+        std::chrono::steady_clock::duration tmp(timeout);
+
+        bool success = concurrent_runner::execute(
+            [&value](std::size_t instance) { return test_load_store< large_struct >(value, instance); },
+            tmp
+        );
+
+        BOOST_TEST(success); // concurrent load/store error
+    }
+
     return boost::report_errors();
 }
@@ -0,0 +1,92 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// The test verifies that the library works with a non-default backoff policy in compare-and-swap loops
+#if !defined(BOOST_ATOMIC_CAS_BACKOFF)
+#define BOOST_ATOMIC_CAS_BACKOFF boost::atomics::randomized_backoff< 8u >
+#endif
+
+#include <boost/atomic.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <type_traits>
+#include <boost/config.hpp>
+
+#include "atomic_wrapper.hpp"
+#include "api_test_helpers.hpp"
+#include "test_thread.hpp"
+#include "test_barrier.hpp"
+
+//! Number of threads that concurrently modify the atomic object
+constexpr unsigned int thread_count = 4u;
+//! Number of operations per thread
+constexpr unsigned int iteration_count = 20000u;
+
+//! The test modifies the atomic object concurrently, which causes compare-and-swap loops to fail and invoke the backoff policy
+template< typename T >
+void test_contended_updates()
+{
+    boost::atomic< T > a((T)0);
+    test_barrier barrier(thread_count);
+    std::vector< std::unique_ptr< test_thread > > threads;
+    for (unsigned int i = 0u; i < thread_count; ++i)
+    {
+        threads.emplace_back(new test_thread([&a, &barrier]()
+        {
+            barrier.arrive_and_wait();
+            for (unsigned int j = 0u; j < iteration_count; ++j)
+            {
+                a.fetch_update([](T v) { return (T)(v + (T)1); }, boost::memory_order_relaxed);
+                a.fetch_add((T)1, boost::memory_order_relaxed);
+            }
+        }));
+    }
+
+    for (auto& thread : threads)
+        thread->join();
+
+    BOOST_TEST_EQ( a.load(), (T)(2u * thread_count * iteration_count) );
+}
+
+template< typename Backoff >
+void test_backoff_policy()
+{
+    Backoff backoff;
+    for (unsigned int i = 0u; i < 100u; ++i)
+        backoff();
+}
+
+int main(int, char *[])
+{
+    static_assert(std::is_same< boost::atomics::detail::cas_backoff, BOOST_ATOMIC_CAS_BACKOFF >::value, "BOOST_ATOMIC_CAS_BACKOFF is not used");
+
+    test_backoff_policy< boost::atomics::no_backoff >();
+    test_backoff_policy< boost::atomics::exponential_backoff<> >();
+    test_backoff_policy< boost::atomics::exponential_backoff< 1u > >();
+    test_backoff_policy< boost::atomics::randomized_backoff<> >();
+    test_backoff_policy< boost::atomics::randomized_backoff< 1u > >();
+
+    test_integral_api< atomic_wrapper, std::uint8_t >();
+    test_integral_api< atomic_wrapper, std::int16_t >();
+    test_integral_api< atomic_wrapper, std::uint32_t >();
+    test_integral_api< atomic_wrapper, std::int64_t >();
+
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    test_floating_point_api< atomic_wrapper, float >();
+    test_floating_point_api< atomic_wrapper, double >();
+#endif
+
+    test_pointer_api< atomic_wrapper, int >();
+
+    test_contended_updates< std::uint32_t >();
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    test_contended_updates< double >();
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,212 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/lock_pool.hpp>
+#include <boost/atomic/capabilities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <boost/config.hpp>
+
+#include "ipc_wait_test_helpers.hpp"
+
+//! The test verifies that the waiting operation blocks until notified, as opposed to polling the atomic value
+template< typename T >
+class wait_blocks_test
+{
+private:
+    ipc_atomic_wrapper< T > m_wrapper;
+    boost::atomic< bool > m_woken;
+    T m_value1, m_value2, m_value3;
+    T m_received_value;
+    test_barrier m_barrier;
+
+public:
+    explicit wait_blocks_test(T value1, T value2, T value3) :
+        m_wrapper(value1),
+        m_woken(false),
+        m_value1(value1),
+        m_value2(value2),
+        m_value3(value3),
+        m_received_value(value1),
+        m_barrier(2)
+    {
+    }
+
+    bool run()
+    {
+        test_thread thread([this]()
+        {
+            m_barrier.arrive_and_wait();
+            m_received_value = m_wrapper.a.wait(m_value1);
+            m_woken.store(true);
+        });
+
+        m_barrier.arrive_and_wait();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // A blocked thread must not observe the modification without a notification
+        m_wrapper.a.store(m_value2);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+        const bool woken_without_notify = m_woken.load();
+
+        m_wrapper.a.store(m_value3);
+        m_wrapper.a.notify_all();
+
+        if (!thread.try_join_for(std::chrono::seconds(5)))
+        {
+            BOOST_ERROR("Thread failed to join");
+            std::abort();
+        }
+
+        // The thread may wake up spuriously, or not block at all if it was not scheduled before the first modification
+        if (woken_without_notify)
+            return false;
+
+        BOOST_TEST_EQ(m_received_value, m_value3);
+
+        return true;
+    }
+};
+
+//! Size of the memory reserved for test objects after the IPC wait table, in bytes
+constexpr std::size_t object_area_size = 4096u;
+
+template< typename T >
+inline void test_wait_blocks_impl(void* object_area, T value1, T value2, T value3, std::true_type)
+{
+    static_assert(sizeof(wait_blocks_test< T >) <= object_area_size, "Test object does not fit in the reserved memory");
+
+    for (unsigned int i = 0u; i < test_retry_count; ++i)
+    {
+        // The atomic object must be located within the memory region of the IPC wait table
+        wait_blocks_test< T >* test = new (object_area) wait_blocks_test< T >(value1, value2, value3);
+        const bool completed = test->run();
+        test->~wait_blocks_test< T >();
+        if (completed)
+            return;
+    }
+
+    BOOST_ERROR("wait_blocks_test could not complete because the blocked thread was woken up without a notification");
+}
+
+template< typename T >
+inline void test_wait_blocks_impl(void*, T, T, T, std::false_type)
+{
+}
+
+//! The test verifies that the waiting operation on an atomic object outside the IPC wait table memory region polls the atomic value
+template< typename T >
+inline void test_wait_outside_region(T value1, T value2)
+{
+    // Avoid creating IPC atomics on the stack as this breaks on Darwin
+    std::unique_ptr< ipc_atomic_wrapper< T > > wrapper(new ipc_atomic_wrapper< T >(value1));
+    if (wrapper->a.has_native_wait_notify())
+        return;
+
+    T received_value = value1;
+    test_thread thread([&wrapper, &received_value, value1]()
+    {
+        received_value = wrapper->a.wait(value1);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The waiting operation does not use the IPC wait table, so it must observe the modification without a notification
+    wrapper->a.store(value2);
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST_EQ(received_value, value2);
+}
+
+template< typename T >
+inline void test_wait_outside_region_impl(T value1, T value2, std::true_type)
+{
+    test_wait_outside_region(value1, value2);
+}
+
+template< typename T >
+inline void test_wait_outside_region_impl(T, T, std::false_type)
+{
+}
+
+//! Invokes the wait/notify tests for an IPC atomic type, with an IPC wait table attached
+template< typename T >
+inline void test_ipc_wait_table(void* object_area, T value1, T value2, T value3)
+{
+    typedef std::integral_constant< bool, boost::ipc_atomic< T >::is_always_lock_free > is_lock_free;
+    test_wait_notify_api< ipc_atomic_wrapper >(value1, value2, value3);
+    test_wait_blocks_impl(object_area, value1, value2, value3, is_lock_free());
+    test_wait_outside_region_impl(value1, value2, is_lock_free());
+}
+
+int main(int, char *[])
+{
+    const std::size_t table_size = boost::atomics::get_ipc_wait_table_size(100u);
+    if (table_size == 0u)
+    {
+        // IPC wait tables are not supported on this platform
+        BOOST_TEST(!boost::atomics::create_ipc_wait_table(nullptr, 0u, 0u));
+        BOOST_TEST(!boost::atomics::attach_ipc_wait_table(nullptr));
+        return boost::report_errors();
+    }
+
+    // The number of entries is rounded up to a power of two
+    BOOST_TEST_EQ(boost::atomics::get_ipc_wait_table_size(128u), table_size);
+    BOOST_TEST_GT(boost::atomics::get_ipc_wait_table_size(129u), table_size);
+    BOOST_TEST_LT(boost::atomics::get_ipc_wait_table_size(1u), table_size);
+
+    // The memory region contains the table, followed by the test objects. Allocate with operator new to guarantee suitable alignment.
+    const std::size_t region_size = table_size + object_area_size;
+    std::unique_ptr< std::max_align_t[] > storage(new std::max_align_t[region_size / sizeof(std::max_align_t) + 2u]);
+    unsigned char* memory = reinterpret_cast< unsigned char* >(storage.get());
+    unsigned char* object_area = memory + table_size;
+
+    BOOST_TEST(!boost::atomics::create_ipc_wait_table(memory, 1u, region_size));
+    BOOST_TEST(!boost::atomics::create_ipc_wait_table(memory + 1u, table_size, region_size));
+    // The region must include the table
+    BOOST_TEST(!boost::atomics::create_ipc_wait_table(memory, table_size, table_size - 1u));
+
+    // The table cannot be attached until initialized
+    std::memset(memory, 0, table_size);
+    BOOST_TEST(!boost::atomics::attach_ipc_wait_table(memory));
+
+    BOOST_TEST(boost::atomics::create_ipc_wait_table(memory, table_size, region_size));
+    BOOST_TEST(boost::atomics::attach_ipc_wait_table(memory));
+
+    test_ipc_wait_table< std::uint8_t >(object_area, 1, 2, 3);
+    test_ipc_wait_table< std::uint16_t >(object_area, 1, 2, 3);
+    test_ipc_wait_table< std::uint32_t >(object_area, 1, 2, 3);
+    test_ipc_wait_table< std::uint64_t >(object_area, 1, 2, 3);
+#if defined(BOOST_HAS_INT128) && !defined(BOOST_ATOMIC_TESTS_NO_INT128)
+    test_ipc_wait_table< boost::uint128_type >(object_area, 1, 2, 3);
+#endif
+
+    boost::atomics::detach_ipc_wait_table();
+    boost::atomics::destroy_ipc_wait_table(memory);
+
+    // Once destroyed, the table cannot be attached
+    BOOST_TEST(!boost::atomics::attach_ipc_wait_table(memory));
+
+    return boost::report_errors();
+}
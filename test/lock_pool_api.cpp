@@ -0,0 +1,120 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/lock_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <boost/config.hpp>
+
+#include "wait_test_helpers.hpp"
+
+//! Tests many concurrent waiting operations on different atomic objects that share the lock pool entries
+void test_many_waiters(large_struct const& s1, large_struct const& s2)
+{
+    constexpr std::size_t waiter_count = 256u;
+
+    std::unique_ptr< boost::atomic< large_struct >[] > objects(new boost::atomic< large_struct >[waiter_count]);
+    std::unique_ptr< bool[] > results(new bool[waiter_count]);
+    boost::atomic< std::size_t > started_count(0u);
+
+    std::vector< std::thread > threads;
+    threads.reserve(waiter_count);
+    for (std::size_t i = 0u; i < waiter_count; ++i)
+    {
+        objects[i].store(s1, boost::memory_order_relaxed);
+        results[i] = false;
+        threads.emplace_back([&objects, &results, &started_count, &s1, &s2, i]()
+        {
+            started_count.fetch_add(1u, boost::memory_order_relaxed);
+            results[i] = objects[i].wait(s1) == s2;
+        });
+    }
+
+    while (started_count.load(boost::memory_order_relaxed) < waiter_count)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // Notify in an order different from the order of waiting to exercise removal of wait states from the middle of the lists
+    for (std::size_t i = 0u; i < waiter_count; ++i)
+    {
+        const std::size_t index = (i * 97u) % waiter_count;
+        objects[index].store(s2);
+        objects[index].notify_one();
+    }
+
+    for (std::size_t i = 0u; i < waiter_count; ++i)
+    {
+        threads[i].join();
+        BOOST_TEST(results[i]);
+    }
+}
+
+//! Tests lock pool statistics after the lock pool was used by waiting operations
+void test_statistics()
+{
+    boost::atomics::lock_pool_statistics stats = {};
+    const std::size_t pool_size = boost::atomics::get_lock_pool_size();
+    BOOST_TEST(!boost::atomics::get_lock_pool_statistics(pool_size, stats));
+
+    if (!boost::atomics::get_lock_pool_statistics(0u, stats))
+        return; // the library was built without statistics
+
+    std::uint64_t short_lock_count = 0u, lock_count = 0u, max_waiter_count = 0u;
+    for (std::size_t i = 0u; i < pool_size; ++i)
+    {
+        BOOST_TEST(boost::atomics::get_lock_pool_statistics(i, stats));
+        BOOST_TEST_LE(stats.contended_short_lock_count, stats.short_lock_count);
+        BOOST_TEST_LE(stats.contended_lock_count, stats.lock_count);
+        BOOST_TEST_LE(stats.spin_lock_count, stats.contended_lock_count);
+        BOOST_TEST_EQ(stats.waiter_count, 0u);
+        BOOST_TEST_LE(stats.max_waiter_count, stats.wait_state_capacity);
+
+        short_lock_count += stats.short_lock_count;
+        lock_count += stats.lock_count;
+        if (stats.max_waiter_count > max_waiter_count)
+            max_waiter_count = stats.max_waiter_count;
+    }
+
+    BOOST_TEST_GT(short_lock_count, 0u);
+    BOOST_TEST_GT(lock_count, 0u);
+    // test_many_waiters blocks 256 threads on atomic objects distributed between 4 locks
+    BOOST_TEST_GE(max_waiter_count, 64u);
+}
+
+int main(int, char *[])
+{
+    // The lock pool size must be set before the lock pool is used. The size is rounded up to a power of two.
+    BOOST_TEST(boost::atomics::set_lock_pool_size(3u));
+    BOOST_TEST_EQ(boost::atomics::get_lock_pool_size(), 4u);
+
+    // Once the lock pool is initialized, its size cannot be changed
+    BOOST_TEST(boost::atomics::set_lock_pool_size(4u));
+    BOOST_TEST(!boost::atomics::set_lock_pool_size(8u));
+    BOOST_TEST_EQ(boost::atomics::get_lock_pool_size(), 4u);
+
+    // Memory for wait states can be reserved in advance and is used by the following waiting operations
+    BOOST_TEST(boost::atomics::reserve_lock_pool_wait_states(0u));
+    BOOST_TEST(boost::atomics::reserve_lock_pool_wait_states(64u));
+
+    // Test that lock-based operations work with the small lock pool
+    {
+        large_struct s1 = {{ 1 }};
+        large_struct s2 = {{ 2 }};
+        large_struct s3 = {{ 3 }};
+        test_wait_notify_api< atomic_wrapper, large_struct >(s1, s2, s3);
+        test_many_waiters(s1, s2);
+    }
+
+    test_statistics();
+
+    return boost::report_errors();
+}
@@ -82,6 +82,9 @@ void verify_lock_free(const char* type_name, int lock_free_macro_val, int lock_f
 #define EXPECT_LLONG_LOCK_FREE 2
 #if defined(BOOST_ATOMIC_DETAIL_X86_HAS_CMPXCHG16B) || defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
 #define EXPECT_INT128_LOCK_FREE 2
+#elif defined(__GNUC__) && !defined(BOOST_ATOMIC_NO_CMPXCHG16B)
+// cmpxchg16b support is detected at run time
+#define EXPECT_INT128_LOCK_FREE 1
 #else
 #define EXPECT_INT128_LOCK_FREE 0
 #endif
@@ -0,0 +1,154 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/wait_any.hpp>
+#include <boost/atomic/capabilities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <boost/config.hpp>
+
+#include "wait_test_helpers.hpp"
+
+//! Set of atomic objects for wait_any tests
+template< template< typename > class Wrapper, typename T >
+class wait_any_objects
+{
+public:
+    using atomic_type = typename Wrapper< T >::atomic_type;
+
+private:
+    std::unique_ptr< Wrapper< T >[] > m_wrappers;
+    std::unique_ptr< atomic_type const*[] > m_objects;
+    std::unique_ptr< T[] > m_old_values;
+    std::size_t m_count;
+
+public:
+    wait_any_objects(std::size_t count, T value) :
+        m_wrappers(new Wrapper< T >[count]),
+        m_objects(new atomic_type const*[count]),
+        m_old_values(new T[count]),
+        m_count(count)
+    {
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            m_wrappers[i].a.store(value);
+            m_objects[i] = &m_wrappers[i].a;
+            m_old_values[i] = value;
+        }
+    }
+
+    typename Wrapper< T >::atomic_reference_type operator[] (std::size_t index) const
+    {
+        return m_wrappers[index].a;
+    }
+
+    std::size_t wait_any() const
+    {
+        return boost::atomics::wait_any(m_objects.get(), m_old_values.get(), m_count);
+    }
+};
+
+//! The test verifies that wait_any returns immediately if any of the passed values does not match the atomic value
+template< template< typename > class Wrapper, typename T >
+inline void test_wait_any_value_mismatch(T value1, T value2)
+{
+    wait_any_objects< Wrapper, T > objects(3u, value1);
+    objects[1].store(value2);
+    BOOST_TEST_EQ(objects.wait_any(), 1u);
+
+    objects[0].store(value2);
+    BOOST_TEST_EQ(objects.wait_any(), 0u);
+}
+
+//! The test verifies that notifying one of the atomic objects releases the blocked thread and wait_any returns the index of that object
+template< template< typename > class Wrapper, typename T >
+inline void test_wait_any_notify(std::size_t count, std::size_t notified_index, T value1, T value2)
+{
+    wait_any_objects< Wrapper, T > objects(count, value1);
+
+    test_barrier barrier(2u);
+    std::size_t received_index = count;
+    std::chrono::steady_clock::time_point wakeup_time;
+
+    test_thread thread([&objects, &barrier, &received_index, &wakeup_time]()
+    {
+        barrier.arrive_and_wait();
+        received_index = objects.wait_any();
+        wakeup_time = std::chrono::steady_clock::now();
+    });
+
+    barrier.arrive_and_wait();
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::this_thread::sleep_until(start_time + std::chrono::milliseconds(200));
+
+    // Notifying an object that did not change does not release the blocked thread
+    objects[count - 1u - notified_index].notify_all();
+
+    std::this_thread::sleep_until(start_time + std::chrono::milliseconds(400));
+
+    objects[notified_index].store(value2);
+    objects[notified_index].notify_one();
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST_EQ(received_index, notified_index);
+    BOOST_TEST((wakeup_time - start_time) >= std::chrono::milliseconds(400));
+}
+
+//! Invokes all wait_any tests
+template< template< typename > class Wrapper, typename T >
+void test_wait_any_api(T value1, T value2)
+{
+    test_wait_any_value_mismatch< Wrapper >(value1, value2);
+    test_wait_any_notify< Wrapper >(3u, 2u, value1, value2);
+    // Test with more objects than can be described on the stack
+    test_wait_any_notify< Wrapper >(40u, 13u, value1, value2);
+}
+
+int main(int, char *[])
+{
+    test_wait_any_api< atomic_wrapper, std::uint8_t >(1, 2);
+    test_wait_any_api< atomic_wrapper, std::uint16_t >(1, 2);
+    test_wait_any_api< atomic_wrapper, std::uint32_t >(1, 2);
+    test_wait_any_api< atomic_wrapper, std::uint64_t >(1, 2);
+#if defined(BOOST_HAS_INT128) && !defined(BOOST_ATOMIC_TESTS_NO_INT128)
+    test_wait_any_api< atomic_wrapper, boost::uint128_type >(1, 2);
+#endif
+    test_wait_any_api< atomic_ref_wrapper, std::uint8_t >(1, 2);
+    test_wait_any_api< atomic_ref_wrapper, std::uint16_t >(1, 2);
+    test_wait_any_api< atomic_ref_wrapper, std::uint32_t >(1, 2);
+    test_wait_any_api< atomic_ref_wrapper, std::uint64_t >(1, 2);
+#if BOOST_ATOMIC_INT32_LOCK_FREE == 2
+    test_wait_any_api< ipc_atomic_wrapper, std::uint32_t >(1, 2);
+#endif
+
+    {
+        struct_3_bytes s1 = {{ 1 }};
+        struct_3_bytes s2 = {{ 2 }};
+        test_wait_any_api< atomic_wrapper, struct_3_bytes >(s1, s2);
+    }
+    {
+        large_struct s1 = {{ 1 }};
+        large_struct s2 = {{ 2 }};
+        test_wait_any_api< atomic_wrapper, large_struct >(s1, s2);
+        test_wait_any_api< atomic_ref_wrapper, large_struct >(s1, s2);
+    }
+
+    return boost::report_errors();
+}
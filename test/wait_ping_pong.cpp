@@ -0,0 +1,141 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that waiting and notifying operations hand off the control between threads promptly when
+// the threads compete for a single CPU. Two threads exchange values through an atomic object, each waiting
+// for the other thread's modification. If a woken thread busy waits for a resource held by the preempted
+// notifying thread (e.g. an internal spin lock), every handoff takes a full scheduler time slice.
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/wait_any.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "test_thread.hpp"
+
+//! Number of round trips between the threads
+constexpr unsigned int round_trip_count = 1000u;
+//! Max expected duration of the test for one atomic type, in milliseconds. Each round trip is expected to take a few microseconds.
+constexpr std::chrono::milliseconds::rep max_duration_ms = 500;
+
+template< typename T >
+void test_ping_pong()
+{
+    boost::atomic< T > a(static_cast< T >(0u));
+
+    test_thread thread([&a]()
+    {
+        for (unsigned int i = 0u; i < round_trip_count; ++i)
+        {
+            a.wait(static_cast< T >(0u));
+            a.store(static_cast< T >(0u));
+            a.notify_one();
+        }
+    });
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < round_trip_count; ++i)
+    {
+        a.store(static_cast< T >(1u));
+        a.notify_one();
+        a.wait(static_cast< T >(1u));
+    }
+    const std::chrono::milliseconds::rep duration_ms = std::chrono::duration_cast< std::chrono::milliseconds >(std::chrono::steady_clock::now() - start).count();
+
+    if (!thread.try_join_for(std::chrono::seconds(10)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST_LT(duration_ms, max_duration_ms);
+}
+
+//! The same as \c test_ping_pong, but one of the threads blocks in \c wait_any on two atomic objects
+template< typename T >
+void test_wait_any_ping_pong()
+{
+    boost::atomic< T > a(static_cast< T >(0u));
+    boost::atomic< T > b(static_cast< T >(0u));
+
+    test_thread thread([&a, &b]()
+    {
+        boost::atomic< T > const* const objects[2] = { &a, &b };
+        const T old_values[2] = { static_cast< T >(0u), static_cast< T >(0u) };
+        for (unsigned int i = 0u; i < round_trip_count; ++i)
+        {
+            while (boost::atomics::wait_any(objects, old_values, 2u) != 0u)
+            {
+            }
+            a.store(static_cast< T >(0u));
+            a.notify_one();
+        }
+    });
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < round_trip_count; ++i)
+    {
+        a.store(static_cast< T >(1u));
+        a.notify_one();
+        a.wait(static_cast< T >(1u));
+    }
+    const std::chrono::milliseconds::rep duration_ms = std::chrono::duration_cast< std::chrono::milliseconds >(std::chrono::steady_clock::now() - start).count();
+
+    if (!thread.try_join_for(std::chrono::seconds(10)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST_LT(duration_ms, max_duration_ms);
+}
+
+int main()
+{
+#if defined(__linux__)
+    // Run all threads on a single CPU, so that the notifying and the woken threads compete for it
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0)
+    {
+        for (int i = 0; i < CPU_SETSIZE; ++i)
+        {
+            if (CPU_ISSET(i, &cpus))
+            {
+                CPU_ZERO(&cpus);
+                CPU_SET(i, &cpus);
+                sched_setaffinity(0, sizeof(cpus), &cpus);
+                break;
+            }
+        }
+    }
+#endif
+
+    test_ping_pong< std::uint8_t >();
+    test_ping_pong< std::uint16_t >();
+    test_ping_pong< std::uint32_t >();
+    test_ping_pong< std::uint64_t >();
+#if defined(BOOST_HAS_INT128) && !defined(BOOST_ATOMIC_TESTS_NO_INT128)
+    test_ping_pong< boost::uint128_type >();
+#endif
+
+    test_wait_any_ping_pong< std::uint8_t >();
+    test_wait_any_ping_pong< std::uint16_t >();
+    test_wait_any_ping_pong< std::uint32_t >();
+    test_wait_any_ping_pong< std::uint64_t >();
+#if defined(BOOST_HAS_INT128) && !defined(BOOST_ATOMIC_TESTS_NO_INT128)
+    test_wait_any_ping_pong< boost::uint128_type >();
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,254 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic/atomic.hpp>
+#include <boost/atomic/atomic_ref.hpp>
+#include <boost/atomic/atomic_flag.hpp>
+#include <boost/atomic/ipc_atomic.hpp>
+#include <boost/atomic/wait_result.hpp>
+#include <boost/atomic/wait_spin_policy.hpp>
+#include <boost/atomic/capabilities.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <boost/config.hpp>
+
+#include "wait_test_helpers.hpp"
+
+//! The test verifies that the wait operation with a spin policy returns immediately if the passed value does not match the atomic value
+template< template< typename > class Wrapper, typename T >
+inline void test_spin_wait_value_mismatch(T value1, T value2)
+{
+    Wrapper< T > wrapper(value1);
+
+    T received_value = wrapper.a.wait(value2, boost::atomics::wait_spin_policy(100u));
+    BOOST_TEST(received_value == value1);
+}
+
+//! The test verifies that the spinning phase observes the modification of the atomic value, even if no notification is made
+template< template< typename > class Wrapper, typename T >
+inline void test_spin_wait_no_notify(T value1, T value2)
+{
+    Wrapper< T > wrapper(value1);
+
+    test_barrier barrier(2u);
+    T received_value = value1;
+
+    test_thread thread([&wrapper, &barrier, &received_value, value1]()
+    {
+        // Spin for up to a minute, which is unlimited for all practical purposes
+        const boost::atomics::wait_spin_policy spin((std::numeric_limits< unsigned int >::max)(), std::chrono::minutes(1));
+        barrier.arrive_and_wait();
+        received_value = wrapper.a.wait(value1, spin);
+    });
+
+    barrier.arrive_and_wait();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    wrapper.a.store(value2);
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST(received_value == value2);
+}
+
+//! The test verifies that the wait operation blocks after the spinning phase is complete and is woken up by notification
+template< template< typename > class Wrapper, typename T >
+inline void test_spin_wait_notify(T value1, T value2, boost::atomics::wait_spin_policy spin)
+{
+    Wrapper< T > wrapper(value1);
+
+    test_barrier barrier(2u);
+    T received_value = value1;
+    std::chrono::steady_clock::time_point wakeup_time;
+
+    test_thread thread([&wrapper, &barrier, &received_value, &wakeup_time, value1, spin]()
+    {
+        barrier.arrive_and_wait();
+        received_value = wrapper.a.wait(value1, spin);
+        wakeup_time = std::chrono::steady_clock::now();
+    });
+
+    barrier.arrive_and_wait();
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::this_thread::sleep_until(start_time + std::chrono::milliseconds(200));
+
+    wrapper.a.store(value2);
+    wrapper.a.notify_one();
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST(received_value == value2);
+    BOOST_TEST((wakeup_time - start_time) >= std::chrono::milliseconds(200));
+}
+
+//! The test verifies that the timed wait operations with a spin policy observe the modification of the atomic value while spinning and time out when not notified
+template< template< typename > class Wrapper, typename T >
+inline void test_spin_timed_wait(T value1, T value2)
+{
+    Wrapper< T > wrapper(value1);
+
+    boost::atomics::wait_result< T > result = wrapper.a.wait_for(value2, std::chrono::milliseconds(200), boost::atomics::wait_spin_policy(100u));
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(!result.timeout);
+
+    // The timed out operations spin and then block until the timeout
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    result = wrapper.a.wait_for(value1, std::chrono::milliseconds(200), boost::atomics::wait_spin_policy(1000u));
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    BOOST_TEST((std::chrono::steady_clock::now() - start_time) >= std::chrono::milliseconds(200));
+
+    start_time = std::chrono::steady_clock::now();
+    result = wrapper.a.wait_until(value1, start_time + std::chrono::milliseconds(200), boost::atomics::wait_spin_policy(1000u));
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    BOOST_TEST((std::chrono::steady_clock::now() - start_time) >= std::chrono::milliseconds(200));
+
+    test_barrier barrier(2u);
+
+    test_thread thread([&wrapper, &barrier, &result, value1]()
+    {
+        // Spin for up to a minute, which is unlimited for all practical purposes
+        const boost::atomics::wait_spin_policy spin((std::numeric_limits< unsigned int >::max)(), std::chrono::minutes(1));
+        barrier.arrive_and_wait();
+        result = wrapper.a.wait_until(value1, std::chrono::steady_clock::now() + std::chrono::minutes(2), spin);
+    });
+
+    barrier.arrive_and_wait();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    wrapper.a.store(value2);
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+
+    BOOST_TEST(result.value == value2);
+    BOOST_TEST(!result.timeout);
+}
+
+//! The test verifies that the spinning phase of the timed wait operations ends when the timeout expires
+template< template< typename > class Wrapper, typename T >
+inline void test_spin_timeout_limits_spinning(T value1)
+{
+    Wrapper< T > wrapper(value1);
+
+    // Spin for up to a minute, which is unlimited for all practical purposes
+    const boost::atomics::wait_spin_policy spin((std::numeric_limits< unsigned int >::max)(), std::chrono::minutes(1));
+
+    // Expired timeouts don't spin
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    boost::atomics::wait_result< T > result = wrapper.a.wait_for(value1, std::chrono::milliseconds(0), spin);
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    BOOST_TEST((std::chrono::steady_clock::now() - start_time) < std::chrono::seconds(5));
+
+    start_time = std::chrono::steady_clock::now();
+    result = wrapper.a.wait_until(value1, start_time - std::chrono::seconds(1), spin);
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    BOOST_TEST((std::chrono::steady_clock::now() - start_time) < std::chrono::seconds(5));
+
+    // The time spent spinning is included in the timeout
+    start_time = std::chrono::steady_clock::now();
+    result = wrapper.a.wait_for(value1, std::chrono::milliseconds(200), spin);
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start_time;
+    BOOST_TEST(elapsed >= std::chrono::milliseconds(200));
+    BOOST_TEST(elapsed < std::chrono::seconds(5));
+
+    start_time = std::chrono::steady_clock::now();
+    result = wrapper.a.wait_until(value1, start_time + std::chrono::milliseconds(200), spin);
+    BOOST_TEST(result.value == value1);
+    BOOST_TEST(result.timeout);
+    elapsed = std::chrono::steady_clock::now() - start_time;
+    BOOST_TEST(elapsed >= std::chrono::milliseconds(200));
+    BOOST_TEST(elapsed < std::chrono::seconds(5));
+}
+
+//! Invokes all spinning wait tests
+template< template< typename > class Wrapper, typename T >
+void test_spin_wait_api(T value1, T value2)
+{
+    test_spin_wait_value_mismatch< Wrapper >(value1, value2);
+    test_spin_wait_no_notify< Wrapper >(value1, value2);
+    // Limited by the number of iterations
+    test_spin_wait_notify< Wrapper >(value1, value2, boost::atomics::wait_spin_policy(1000u));
+    // Limited by time
+    test_spin_wait_notify< Wrapper >(value1, value2, boost::atomics::wait_spin_policy((std::numeric_limits< unsigned int >::max)(), std::chrono::microseconds(100)));
+    // No spinning
+    test_spin_wait_notify< Wrapper >(value1, value2, boost::atomics::wait_spin_policy(0u));
+    test_spin_timed_wait< Wrapper >(value1, value2);
+    test_spin_timeout_limits_spinning< Wrapper >(value1);
+}
+
+//! Tests spinning waits of atomic_flag
+inline void test_spin_flag_wait()
+{
+    boost::atomic_flag f;
+    BOOST_TEST(f.wait(true, boost::atomics::wait_spin_policy(100u)) == false);
+    BOOST_TEST(f.wait_for(true, std::chrono::milliseconds(200), boost::atomics::wait_spin_policy(100u)).value == false);
+    BOOST_TEST(f.wait_until(false, std::chrono::steady_clock::now() + std::chrono::milliseconds(10), boost::atomics::wait_spin_policy(100u)).timeout);
+
+    test_thread thread([&f]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        f.test_and_set();
+        f.notify_one();
+    });
+
+    BOOST_TEST(f.wait(false, boost::atomics::wait_spin_policy(1000u)) == true);
+
+    if (!thread.try_join_for(std::chrono::seconds(5)))
+    {
+        BOOST_ERROR("Thread failed to join");
+        std::abort();
+    }
+}
+
+int main(int, char *[])
+{
+    test_spin_wait_api< atomic_wrapper, std::uint8_t >(1, 2);
+    test_spin_wait_api< atomic_wrapper, std::uint32_t >(1, 2);
+    test_spin_wait_api< atomic_wrapper, std::uint64_t >(1, 2);
+    test_spin_wait_api< atomic_ref_wrapper, std::uint32_t >(1, 2);
+#if BOOST_ATOMIC_INT32_LOCK_FREE == 2
+    test_spin_wait_api< ipc_atomic_wrapper, std::uint32_t >(1, 2);
+#endif
+
+    {
+        struct_3_bytes s1 = {{ 1 }};
+        struct_3_bytes s2 = {{ 2 }};
+        test_spin_wait_api< atomic_wrapper, struct_3_bytes >(s1, s2);
+    }
+    {
+        large_struct s1 = {{ 1 }};
+        large_struct s2 = {{ 2 }};
+        test_spin_wait_api< atomic_wrapper, large_struct >(s1, s2);
+    }
+
+    test_spin_flag_wait();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,89 @@
+//  Copyright (c) 2025 Andrey Semashev
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic/waiter_tracking_atomic.hpp>
+#include <boost/atomic/capabilities.hpp>
+
+#include <cstdint>
+#include <chrono>
+#include <limits>
+#include <boost/config.hpp>
+
+#include "wait_test_helpers.hpp"
+
+//! Wrapper type for waiter_tracking_atomic template
+template< typename T >
+struct waiter_tracking_atomic_wrapper
+{
+    using atomic_type = boost::waiter_tracking_atomic< T >;
+    using atomic_reference_type = atomic_type&;
+
+    atomic_type a;
+
+    waiter_tracking_atomic_wrapper() = default;
+    explicit waiter_tracking_atomic_wrapper(T const& value) : a(value) {}
+};
+
+//! The test verifies that notifying operations without blocked threads don't affect subsequent waiting operations
+template< typename T >
+inline void test_notify_without_waiters(T value1, T value2)
+{
+    boost::waiter_tracking_atomic< T > a(value1);
+    a.notify_one();
+    a.notify_all();
+
+    a.store(value2);
+    a.notify_one();
+    BOOST_TEST(a.wait(value1) == value2);
+    BOOST_TEST(a.wait(value1, boost::atomics::wait_spin_policy(100u)) == value2);
+}
+
+//! The test verifies that the spinning phase of the timed wait operations ends when the timeout expires
+template< typename T >
+inline void test_spin_timeout_limits_spinning(T value1)
+{
+    boost::waiter_tracking_atomic< T > a(value1);
+
+    // Spin for up to a minute, which is unlimited for all practical purposes
+    const boost::atomics::wait_spin_policy spin((std::numeric_limits< unsigned int >::max)(), std::chrono::minutes(1));
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    BOOST_TEST(a.wait_for(value1, std::chrono::milliseconds(0), spin).timeout);
+    BOOST_TEST(a.wait_until(value1, start_time - std::chrono::seconds(1), spin).timeout);
+    BOOST_TEST(a.wait_for(value1, std::chrono::milliseconds(100), spin).timeout);
+    BOOST_TEST((std::chrono::steady_clock::now() - start_time) < std::chrono::seconds(5));
+}
+
+int main(int, char *[])
+{
+    test_wait_notify_api< waiter_tracking_atomic_wrapper, std::uint8_t >(1, 2, 3, BOOST_ATOMIC_HAS_NATIVE_INT8_WAIT_NOTIFY);
+    test_wait_notify_api< waiter_tracking_atomic_wrapper, std::uint16_t >(1, 2, 3, BOOST_ATOMIC_HAS_NATIVE_INT16_WAIT_NOTIFY);
+    test_wait_notify_api< waiter_tracking_atomic_wrapper, std::uint32_t >(1, 2, 3, BOOST_ATOMIC_HAS_NATIVE_INT32_WAIT_NOTIFY);
+    test_wait_notify_api< waiter_tracking_atomic_wrapper, std::uint64_t >(1, 2, 3, BOOST_ATOMIC_HAS_NATIVE_INT64_WAIT_NOTIFY);
+#if !defined(BOOST_ATOMIC_NO_FLOATING_POINT)
+    test_wait_notify_api< waiter_tracking_atomic_wrapper, double >(1.0, 2.0, 3.0);
+#endif
+
+    {
+        struct_3_bytes s1 = {{ 1 }};
+        struct_3_bytes s2 = {{ 2 }};
+        struct_3_bytes s3 = {{ 3 }};
+        test_wait_notify_api< waiter_tracking_atomic_wrapper, struct_3_bytes >(s1, s2, s3);
+    }
+    {
+        large_struct s1 = {{ 1 }};
+        large_struct s2 = {{ 2 }};
+        large_struct s3 = {{ 3 }};
+        test_wait_notify_api< waiter_tracking_atomic_wrapper, large_struct >(s1, s2, s3);
+    }
+
+    test_notify_without_waiters< std::uint32_t >(1, 2);
+    test_notify_without_waiters< std::uint64_t >(1, 2);
+    test_spin_timeout_limits_spinning< std::uint32_t >(1);
+    test_spin_timeout_limits_spinning< std::uint64_t >(1);
+
+    return boost::report_errors();
+}